@@ -22,10 +22,17 @@
 
 #include "tvgCommon.h"
 #include "thorvg_capi.h"
-#include "tvgWasmDefaultFont.h"
+#include "tvgWasmEngine.h"
+#include "tvgWasmAssetCache.h"
+#include "tvgWasmStats.h"
 #include <emscripten.h>
 #include <emscripten/bind.h>
+#ifdef __EMSCRIPTEN_PTHREADS__
+    #include <emscripten/threading.h>
+#endif
+#include <algorithm>
 #include <string>
+#include <vector>
 
 using namespace tvg;
 using emscripten::class_;
@@ -33,10 +40,30 @@ using emscripten::val;
 using emscripten::typed_memory_view;
 using std::string;
 
+//the size of the preallocated pthread pool (see meson_options.txt)
+#ifndef THORVG_WASM_THREADS
+    #ifdef __EMSCRIPTEN_PTHREADS__
+        #error "THORVG_WASM_THREADS is required by the pthread build, it'd rasterize on a single thread otherwise"
+    #endif
+    #define THORVG_WASM_THREADS 0
+#endif
 
 struct TvgEngineMethod
 {
-    virtual ~TvgEngineMethod() {}
+    uint32_t reallocs = 0;    //reallocations of the target buffer
+    ColorSpace cs = ColorSpace::ABGR8888S;  //the pixel format of the sw target
+    bool retained = false;    //holds the shared engine context
+
+    virtual ~TvgEngineMethod()
+    {
+        if (retained) releaseEngine();
+    }
+
+    bool retain(uint32_t threads = 0)
+    {
+        return (retained = retainEngine(threads));
+    }
+
     virtual Canvas* init(string& selector) = 0;
     virtual void resize(Canvas* canvas, uint32_t w, uint32_t h) = 0;
     virtual val output(uint32_t w, uint32_t h)
@@ -44,51 +71,113 @@ struct TvgEngineMethod
         return val::undefined();
     }
 
-    void loadFont() {
-        Text::load("default", requestFont(), DEFAULT_FONT_SIZE, "ttf", false);
+    // a frame is about to be drawn while the presented one must stay intact
+    virtual void flip(Canvas* canvas, uint32_t w, uint32_t h) {}
+
+    // the frame is synced, present it while the next one is rasterized
+    virtual void swap(Canvas* canvas, uint32_t w, uint32_t h) {}
+
+    // the pixel format of the target buffers, false if the engine doesn't render to the cpu memory
+    virtual bool colorSpace(ColorSpace value)
+    {
+        return false;
     }
 };
 
 #ifdef THORVG_SW_RASTER_SUPPORT
 
+/* Double buffered on demand: a synced frame is presented in place, and only a frame drawn while the presented one
+   must stay intact (beginFrame() of the caller) flips the target to the second buffer, allocated by the first flip.
+   So the single-threaded render() keeps one buffer and no copy. A flip retargets the canvas, which updates all
+   the paints again on its next draw. */
 struct TvgSwEngine : TvgEngineMethod
 {
-    uint8_t* buffer = nullptr;
+    uint8_t* buffers[2] = {nullptr, nullptr};
+    size_t capacity[2] = {0, 0};
+    int current = 0;            //the target of the canvas
+    int front = -1;             //the presented buffer, -1 if none
 
     ~TvgSwEngine()
     {
-        std::free(buffer);
-        Initializer::term();
-        retrieveFont();
+        recycleBuffer(buffers[0], capacity[0]);
+        recycleBuffer(buffers[1], capacity[1]);
+    }
+
+    static uint32_t threads()
+    {
+#ifdef __EMSCRIPTEN_PTHREADS__
+        //the calling thread joins the rasterizing, don't request more workers than the pool size
+        auto cores = emscripten_num_logical_cores();
+        return std::min(uint32_t(THORVG_WASM_THREADS), uint32_t(cores > 1 ? cores - 1 : 1));
+#else
+        return 0;
+#endif
     }
 
     Canvas* init(string& selector) override
     {
-        if (Initializer::init() != Result::Success) return nullptr;
-        loadFont();
+        if (!retain(threads())) return nullptr;
         return SwCanvas::gen();
     }
 
+    void target(Canvas* canvas, uint32_t w, uint32_t h)
+    {
+        static_cast<SwCanvas*>(canvas)->target(
+            (uint32_t*)buffers[current], w, w, h, cs
+        );
+    }
+
+    //grow only, the buffers are shared with the other canvases through the engine context
+    bool reserve(int i, size_t size)
+    {
+        if (buffers[i] && capacity[i] >= size) return true;
+        recycleBuffer(buffers[i], capacity[i]);
+        buffers[i] = acquireBuffer(size, capacity[i]);
+        ++reallocs;
+        return buffers[i] != nullptr;
+    }
+
     void resize(Canvas* canvas, uint32_t w, uint32_t h) override
     {
         if (!canvas) return;
 
-        std::free(buffer);
-        buffer = (uint8_t*)std::malloc(w * h * 4);
-        if (!buffer) return;
+        auto size = size_t(w) * h * 4;
+        current = 0;
+        front = -1;
+        if (!reserve(0, size)) return;
+        if (buffers[1]) reserve(1, size);   //in use by the frame pipeline, keep it in size
 
-        static_cast<SwCanvas*>(canvas)->target(
-            (uint32_t*)buffer, w, w, h, ColorSpace::ABGR8888S
-        );
+        target(canvas, w, h);
+    }
+
+    void flip(Canvas* canvas, uint32_t w, uint32_t h) override
+    {
+        if (front != current) return;      //nothing presented in the target
+
+        auto back = current ^ 1;
+        if (!reserve(back, size_t(w) * h * 4)) return;
+        current = back;
+        target(canvas, w, h);
+    }
+
+    void swap(Canvas* canvas, uint32_t w, uint32_t h) override
+    {
+        front = current;
     }
 
     val output(uint32_t w, uint32_t h) override
     {
-        if (buffer) {
-            return val(typed_memory_view(w * h * 4, buffer));
+        if (front >= 0) {
+            return val(typed_memory_view(w * h * 4, buffers[front]));
         }
         return val::undefined();
     }
+
+    bool colorSpace(ColorSpace value) override
+    {
+        cs = value;
+        return true;
+    }
 };
 
 #endif
@@ -111,8 +200,6 @@ struct TvgWgEngine : TvgEngineMethod
     ~TvgWgEngine()
     {
         if (surface) wgpuSurfaceRelease(surface);
-        Initializer::term();
-        retrieveFont();
     }
 
     Canvas* init(string& selector) override
@@ -129,9 +216,7 @@ struct TvgWgEngine : TvgEngineMethod
         surface = wgpuInstanceCreateSurface(instance, &surfaceDesc);
 
         if (!surface) return nullptr;
-
-        if (Initializer::init() != Result::Success) return nullptr;
-        loadFont();
+        if (!retain()) return nullptr;
 
         return WgCanvas::gen();
     }
@@ -241,11 +326,9 @@ struct TvgGlEngine : TvgEngineMethod
     ~TvgGlEngine()
     {
         if (context) {
-            Initializer::term();
             emscripten_webgl_destroy_context(context);
             context = 0;
         }
-        retrieveFont();
     }
 
     Canvas* init(string& selector) override
@@ -265,8 +348,7 @@ struct TvgGlEngine : TvgEngineMethod
 
         emscripten_webgl_make_context_current(context);
 
-        if (Initializer::init() != Result::Success) return nullptr;
-        loadFont();
+        if (!retain()) return nullptr;
 
         return GlCanvas::gen();
     }
@@ -292,16 +374,161 @@ int init() {
 #endif
 }
 
+// terminates the shared engine context, the canvases must be destroyed before
 void term() {
+    termEngine();
 #ifdef THORVG_WG_RASTER_SUPPORT
     TvgWgEngine::term();
 #endif
 }
 
+// registers the embedded font as the "default" family, it's done on demand by the first text using it
+bool defaultFont() {
+    return loadDefaultFont();
+}
+
+// loads the font through the module-wide asset cache, returns its handle for releaseFont() or 0 on failure
+uintptr_t retainFont(string name, val buffer, string mimetype) {
+    auto asset = retainAsset(name, buffer);
+    if (!asset) return 0;
+    if (!loadAssetFont(asset, mimetype.c_str())) {
+        releaseAsset(asset);
+        return 0;
+    }
+    return reinterpret_cast<uintptr_t>(asset);
+}
+
+void releaseFont(uintptr_t handle) {
+    releaseAsset(reinterpret_cast<TvgAsset*>(handle));
+}
+
+/* Opcodes of the command stream of TvgCanvas::submit(). A command is 32-bit words of
+   the opcode, the paint handle and the fixed number of arguments (TVG_CMD_ARGS) following it.
+   The arguments are floats, except the colors (RGBA packed as r | g << 8 | b << 16 | a << 24),
+   the opacity and the clockwise flags, which are unsigned integers. */
+enum class TvgCmd : uint32_t {
+    MoveTo = 0,     //x, y
+    LineTo,         //x, y
+    CubicTo,        //cx1, cy1, cx2, cy2, x, y
+    Close,
+    Reset,
+    AppendRect,     //x, y, w, h, rx, ry, clockwise
+    AppendCircle,   //cx, cy, rx, ry, clockwise
+    Fill,           //color
+    StrokeWidth,    //width
+    StrokeFill,     //color
+    Translate,      //x, y
+    Rotate,         //degree
+    Scale,          //factor
+    Opacity,        //opacity
+    Transform,      //e11, e12, e13, e21, e22, e23, e31, e32, e33
+    Count
+};
+
+static constexpr uint8_t TVG_CMD_ARGS[] = {2, 2, 6, 0, 0, 7, 5, 1, 1, 1, 2, 1, 1, 1, 9};
+
+static void applyCmd(TvgCmd cmd, Paint* paint, const uint32_t* words, const float* args) {
+    //shape commands on the other paints are ignored
+    auto shape = paint->type() == Type::Shape ? static_cast<Shape*>(paint) : nullptr;
+    auto color = [words](int i, uint8_t ch) { return uint8_t(words[i] >> (ch * 8)); };
+
+    switch (cmd) {
+        case TvgCmd::MoveTo: if (shape) shape->moveTo(args[0], args[1]); break;
+        case TvgCmd::LineTo: if (shape) shape->lineTo(args[0], args[1]); break;
+        case TvgCmd::CubicTo: if (shape) shape->cubicTo(args[0], args[1], args[2], args[3], args[4], args[5]); break;
+        case TvgCmd::Close: if (shape) shape->close(); break;
+        case TvgCmd::Reset: if (shape) shape->reset(); break;
+        case TvgCmd::AppendRect: if (shape) shape->appendRect(args[0], args[1], args[2], args[3], args[4], args[5], words[6] != 0); break;
+        case TvgCmd::AppendCircle: if (shape) shape->appendCircle(args[0], args[1], args[2], args[3], words[4] != 0); break;
+        case TvgCmd::Fill: if (shape) shape->fill(color(0, 0), color(0, 1), color(0, 2), color(0, 3)); break;
+        case TvgCmd::StrokeWidth: if (shape) shape->strokeWidth(args[0]); break;
+        case TvgCmd::StrokeFill: if (shape) shape->strokeFill(color(0, 0), color(0, 1), color(0, 2), color(0, 3)); break;
+        case TvgCmd::Translate: paint->translate(args[0], args[1]); break;
+        case TvgCmd::Rotate: paint->rotate(args[0]); break;
+        case TvgCmd::Scale: paint->scale(args[0]); break;
+        case TvgCmd::Opacity: paint->opacity(uint8_t(words[0])); break;
+        case TvgCmd::Transform: paint->transform({args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7], args[8]}); break;
+        default: break;
+    }
+}
+
+/* The shapes of TvgCanvas::acquireShapes(), for the paints spawned and dropped at a high rate (i.e. particles).
+   They stay on the canvas once made: a released one is reset and hidden instead of freed, and handed out again
+   by the next acquire(), so a steady state doesn't allocate at all. */
+struct TvgShapePool {
+    struct Slot {
+        Shape* shape;
+        bool live;      //acquired, not released yet
+    };
+
+    std::vector<Slot> slots;        //sorted by the address, to look the handles up
+    std::vector<Shape*> idle;       //the released shapes
+    std::vector<uint32_t> range;    //the handles of the last acquire()
+
+    Slot* find(uintptr_t handle) {
+        auto it = std::lower_bound(slots.begin(), slots.end(), handle, [](const Slot& slot, uintptr_t handle) {
+            return uintptr_t(slot.shape) < handle;
+        });
+        if (it == slots.end() || uintptr_t(it->shape) != handle) return nullptr;
+        return &*it;
+    }
+
+    // the handles of count shapes, the idle ones first and then the new ones pushed to the canvas
+    uint32_t* acquire(Canvas* canvas, uint32_t count) {
+        range.resize(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            Shape* shape;
+            if (!idle.empty()) {
+                shape = idle.back();
+                idle.pop_back();
+                shape->visible(true);
+                find(uintptr_t(shape))->live = true;
+            } else {
+                shape = Shape::gen();
+                shape->ref();   //the pool keeps it even if it's removed from the canvas
+                canvas->push(shape);
+                auto at = std::upper_bound(slots.begin(), slots.end(), shape, [](Shape* shape, const Slot& slot) {
+                    return uintptr_t(shape) < uintptr_t(slot.shape);
+                });
+                slots.insert(at, {shape, true});
+            }
+            range[i] = uint32_t(uintptr_t(shape));
+        }
+        return range.data();
+    }
+
+    // resets the path, the transform and the opacity of the live shapes of the handles and hides them, returns the released ones
+    uint32_t release(const uint32_t* handles, uint32_t count) {
+        uint32_t released = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            auto slot = find(handles[i]);
+            if (!slot || !slot->live) continue;
+            slot->live = false;
+            slot->shape->reset();
+            slot->shape->transform({1, 0, 0, 0, 1, 0, 0, 0, 1});
+            slot->shape->opacity(255);
+            slot->shape->visible(false);
+            idle.push_back(slot->shape);
+            ++released;
+        }
+        return released;
+    }
+
+    // frees the shapes, the canvas doesn't have them anymore
+    void clear() {
+        for (auto& slot : slots) slot.shape->unref();
+        slots.clear();
+        idle.clear();
+        range.clear();
+    }
+};
+
 class __attribute__((visibility("default"))) TvgCanvas {
 public:
     ~TvgCanvas() {
+        if (drawing) canvas->sync();
         if (canvas) delete canvas;
+        shapes.clear();
         if (engine) delete engine;
     }
 
@@ -341,6 +568,7 @@ public:
         if (width == w && height == h) return true;
 
         canvas->sync();
+        drawing = false;
 
         width = w;
         height = h;
@@ -350,17 +578,157 @@ public:
         return true;
     }
 
+    /* the pixel format of the sw output: "abgr8888s" (default, straight RGBA as ImageData takes it), "argb8888s",
+       or the premultiplied "abgr8888" and "argb8888". It's rasterized in the format, there is no conversion pass. */
+    bool colorSpace(string name) {
+        if (!canvas || !engine) return false;
+
+        auto value = colorSpaceOf(name);
+        if (value == ColorSpace::Unknown) {
+            errorMsg = "Unknown color space";
+            return false;
+        }
+        if (value == engine->cs) return true;
+
+        canvas->sync();
+        drawing = false;
+
+        if (!engine->colorSpace(value)) {
+            errorMsg = "colorSpace() is for the sw engine";
+            return false;
+        }
+
+        //retarget, the presented frame is in the previous format
+        if (width > 0 && height > 0) engine->resize(canvas, width, height);
+        return true;
+    }
+
     bool clear() {
         if (!canvas) return false;
+        if (drawing) endFrame();
         canvas->remove();
+        shapes.clear();
         return true;
     }
 
+    /* Hands out count pooled shapes on top of the canvas and returns the address of their handles (count words)
+       in the wasm memory, valid until the next call. The handles are the paint pointers the command buffer takes.
+       The fill and the stroke of a reused shape carry over from its previous use. */
+    uintptr_t acquireShapes(uint32_t count) {
+        if (!canvas || count == 0) return 0;
+        if (drawing) endFrame();
+        return reinterpret_cast<uintptr_t>(shapes.acquire(canvas, count));
+    }
+
+    // gives back the pooled shapes of the count handles at ptr for reuse, returns the number of the released ones
+    uint32_t releaseShapes(uintptr_t ptr, uint32_t count) {
+        if (!canvas || !ptr) return 0;
+        if (drawing) endFrame();
+        return shapes.release(reinterpret_cast<const uint32_t*>(ptr), count);
+    }
+
+    // draws a frame and returns the view of its pixels (sw only)
     val render() {
         if (!canvas || !engine) return val::undefined();
+        draw();
         return engine->output(width, height);
     }
 
+    // the view of the last presented frame's pixels (sw only), valid until the next endFrame() or resize()
+    val output() {
+        if (!canvas || !engine) return val::undefined();
+        return engine->output(width, height);
+    }
+
+    // canvas update, returns the result code
+    int update() {
+        if (!canvas) return int(Result::InsufficientCondition);
+        if (drawing) endFrame();
+
+        auto begin = profile.begin();
+        auto result = canvas->update();
+        profile.end(TvgStats::Update, begin);
+
+        if (profile.enabled) {
+            for (auto paint : canvas->paints()) profile.count(paint);
+        }
+
+        return int(result);
+    }
+
+    /* Starts rasterizing a frame into the back buffer without waiting for it, the multi-threaded build
+       rasterizes it in the workers meanwhile. A frame still in flight is finished first. Returns the result code. */
+    int beginFrame() {
+        return start(true);
+    }
+
+    // waits for the frame of beginFrame(), then presents it. Returns the view of its pixels (sw only)
+    val endFrame() {
+        if (!canvas || !engine) return val::undefined();
+
+        if (drawing) {
+            drawing = false;
+
+            auto begin = profile.begin();
+            synced = canvas->sync();
+            profile.end(TvgStats::Sync, begin);
+
+            if (synced == Result::Success) {
+                engine->swap(canvas, width, height);
+                ++profile.frames;
+                profile.bytes += width * height * 4;
+            }
+        }
+        return engine->output(width, height);
+    }
+
+    // canvas draw and sync, returns the result code
+    int draw() {
+        auto result = start(false);
+        if (result != int(Result::Success)) return result;
+        endFrame();
+        return int(synced);
+    }
+
+    /* Applies the command stream (see TvgCmd) of len words at ptr in one call, instead of a C API call per change.
+       If render is true, updates and draws the canvas after it. Returns the result code. */
+    int submit(uintptr_t ptr, uint32_t len, bool render) {
+        if (!canvas) return int(Result::InsufficientCondition);
+        if (drawing) endFrame();
+
+        auto words = reinterpret_cast<const uint32_t*>(ptr);
+        auto args = reinterpret_cast<const float*>(ptr);
+
+        for (uint32_t i = 0; i + 2 <= len; ) {
+            auto cmd = words[i];
+            if (cmd >= uint32_t(TvgCmd::Count) || i + 2 + TVG_CMD_ARGS[cmd] > len) return int(Result::InvalidArguments);
+            auto paint = reinterpret_cast<Paint*>(uintptr_t(words[i + 1]));
+            if (paint) applyCmd(TvgCmd(cmd), paint, words + i + 2, args + i + 2);
+            i += 2 + TVG_CMD_ARGS[cmd];
+        }
+
+        if (!render) return int(Result::Success);
+
+        auto result = update();
+        if (result != int(Result::Success)) return result;
+        return draw();
+    }
+
+    // turns on/off the timings and counters of stats(), they start over when it's turned on
+    void enableStats(bool on) {
+        if (on && !profile.enabled) profile.reset();
+        profile.enabled = on;
+    }
+
+    val stats() {
+        return profile.report(engine ? engine->reallocs : 0);
+    }
+
+    // the time (ms) the caller took to upload the rendered frame, i.e. putImageData()
+    void recordUpload(double ms) {
+        profile.record(TvgStats::Upload, ms);
+    }
+
     val size() {
         val result = val::object();
         result.set("width", width);
@@ -373,23 +741,56 @@ public:
     }
 
 private:
+    // flip: keep the presented frame intact while this one is drawn
+    int start(bool flip) {
+        if (!canvas || !engine) return int(Result::InsufficientCondition);
+        if (drawing) endFrame();
+        if (flip) engine->flip(canvas, width, height);
+
+        auto begin = profile.begin();
+        auto result = canvas->draw(true);
+        profile.end(TvgStats::Draw, begin);
+
+        drawing = (result == Result::Success);
+        return int(result);
+    }
+
     Canvas* canvas = nullptr;
     TvgEngineMethod* engine = nullptr;
     uint32_t width = 0;
     uint32_t height = 0;
+    TvgShapePool shapes;
+    TvgStats profile;
+    Result synced = Result::Success;    //the sync result of the last frame
+    bool drawing = false;               //a frame is in flight between beginFrame() and endFrame()
     string errorMsg;
 };
 
 EMSCRIPTEN_BINDINGS(thorvg_canvaskit) {
     emscripten::function("init", &init);
     emscripten::function("term", &term);
+    emscripten::function("defaultFont", &defaultFont);
+    emscripten::function("retainFont", &retainFont);
+    emscripten::function("releaseFont", &releaseFont);
 
     class_<TvgCanvas>("TvgCanvas")
         .constructor<string, string, uint32_t, uint32_t>()
         .function("error", &TvgCanvas::error)
         .function("resize", &TvgCanvas::resize)
         .function("clear", &TvgCanvas::clear)
+        .function("colorSpace", &TvgCanvas::colorSpace)
         .function("render", &TvgCanvas::render)
+        .function("output", &TvgCanvas::output)
+        .function("beginFrame", &TvgCanvas::beginFrame)
+        .function("endFrame", &TvgCanvas::endFrame)
         .function("size", &TvgCanvas::size)
+        .function("update", &TvgCanvas::update)
+        .function("draw", &TvgCanvas::draw)
+        .function("submit", &TvgCanvas::submit)
+        .function("acquireShapes", &TvgCanvas::acquireShapes)
+        .function("releaseShapes", &TvgCanvas::releaseShapes)
+        .function("enableStats", &TvgCanvas::enableStats)
+        .function("stats", &TvgCanvas::stats)
+        .function("recordUpload", &TvgCanvas::recordUpload)
         .function("ptr", &TvgCanvas::ptr);
 }
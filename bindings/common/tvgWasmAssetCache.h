@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 the ThorVG project. All rights reserved.
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _TVG_WASM_ASSET_CACHE_H_
+#define _TVG_WASM_ASSET_CACHE_H_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <thorvg.h>
+#include <emscripten/bind.h>
+
+/* Module-wide cache of the external assets (images, fonts) given by the JS side.
+   The bytes of an asset are kept only once at a fixed address, so every picture loading them
+   without a copy shares the same decoded loader, and a font is loaded once by its name.
+   The assets are reference counted by their users and dropped along with the last one. */
+
+struct TvgAsset
+{
+    std::string key;
+    std::string name;
+    std::vector<char> data;
+    uint32_t refCnt = 0;
+    bool font = false;
+};
+
+inline std::unordered_map<std::string, TvgAsset*>& _assetMap()
+{
+    static std::unordered_map<std::string, TvgAsset*> assets;
+    return assets;
+}
+
+//FNV-1a
+inline uint64_t _assetHash(const char* data, size_t size)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/* buffer: ArrayBuffer or a typed array of the asset bytes. Returns the shared asset of the same name and contents
+   if there is one, otherwise a new one. nullptr if the buffer is empty. */
+inline TvgAsset* retainAsset(const std::string& name, emscripten::val buffer)
+{
+    auto Uint8Array = emscripten::val::global("Uint8Array");
+    auto bytes = buffer.instanceof(emscripten::val::global("ArrayBuffer")) ? Uint8Array.new_(buffer) : Uint8Array.new_(buffer["buffer"], buffer["byteOffset"], buffer["byteLength"]);
+    auto size = bytes["length"].as<size_t>();
+    if (size == 0) return nullptr;
+
+    //a single bulk copy (HEAPU8.set) into the wasm memory
+    std::vector<char> data(size);
+    emscripten::val(emscripten::typed_memory_view(size, reinterpret_cast<uint8_t*>(data.data()))).call<void>("set", bytes);
+
+    auto key = name + ":" + std::to_string(size) + ":" + std::to_string(_assetHash(data.data(), size));
+    auto& assets = _assetMap();
+
+    auto it = assets.find(key);
+    if (it != assets.end()) {
+        ++it->second->refCnt;
+        return it->second;
+    }
+
+    auto asset = new TvgAsset;
+    asset->key = key;
+    asset->name = name;
+    asset->data = std::move(data);
+    asset->refCnt = 1;
+    assets[key] = asset;
+    return asset;
+}
+
+// loads the asset as a font by its name, once
+inline bool loadAssetFont(TvgAsset* asset, const char* mimetype)
+{
+    if (asset->font) return true;
+    if (tvg::Text::load(asset->name.c_str(), asset->data.data(), asset->data.size(), mimetype, false) != tvg::Result::Success) return false;
+    asset->font = true;
+    return true;
+}
+
+inline void releaseAsset(TvgAsset* asset)
+{
+    if (!asset || --asset->refCnt > 0) return;
+    if (asset->font) tvg::Text::load(asset->name.c_str(), nullptr, 0);
+    _assetMap().erase(asset->key);
+    delete(asset);
+}
+
+#endif //_TVG_WASM_ASSET_CACHE_H_
@@ -95,10 +95,11 @@
 #ifndef _TVG_WASM_DEFAULT_FONT_H_
 #define _TVG_WASM_DEFAULT_FONT_H_
 
-#ifdef THORVG_TTF_LOADER_SUPPORT
+//THORVG_WASM_NO_DEFAULT_FONT: leaves the embedded font out of the module (see meson_options.txt)
+#if defined(THORVG_TTF_LOADER_SUPPORT) && !defined(THORVG_WASM_NO_DEFAULT_FONT)
 
 #include <cstddef>
-#include <atomic>
+#include <cstring>
 
 constexpr size_t COMPRESSED_FONT_SIZE = 9721;
 constexpr size_t DEFAULT_FONT_SIZE = 14852;
@@ -106,18 +107,25 @@ constexpr size_t DEFAULT_FONT_SIZE = 14852;
 constexpr const unsigned char COMPRESSED_FONT[] = {
     0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0xFF, 0x00, 0x03, 0x00, 0x70, 0x47, 0x44, 0x45, 0x46, 0xFF, 0x02, 0xDE, 0x04, 0xA8, 0x00, 0x00, 0x1C, 0x68, 0xFE, 0x01, 0x60, 0x9C, 0x47, 0x50, 0x4F, 0x53, 0x88, 0xA0, 0xFF, 0x83, 0x1B, 0x00, 0x00, 0x1D, 0x04, 0x00, 0x00, 0xFF, 0x0C, 0xC2, 0x47, 0x53, 0x55, 0x42, 0xA9, 0x9C, 0xFF, 0xA2, 0xC4, 0x00, 0x00, 0x29, 0xC8, 0x00, 0x00, 0xFF, 0x01, 0x5C, 0x4F, 0x53, 0x2F, 0x32, 0x60, 0x78, 0xBF, 0x54, 0xC9, 0x00, 0x00, 0x19, 0x3C, 0x04, 0x60, 0x60, 0xFF, 0x53, 0x54, 0x41, 0x54, 0x57, 0x16, 0x41, 0xEF, 0xEF, 0x00, 0x00, 0x2B, 0x24, 0x05, 0x60, 0x5E, 0x63, 0x6D, 0xDF, 0x61, 0x70, 0x01, 0x2C, 0x01, 0x03, 0x00, 0x19, 0x9C, 0xFE, 0x06, 0x60, 0x54, 0x67, 0x6C, 0x79, 0x66, 0x41, 0xE0, 0xFB, 0xEB, 0x89, 0x07, 0x20, 0xFC, 0x00, 0x00, 0x15, 0xDA, 0xFF, 0x68, 0x65, 0x61, 0x64, 0x24, 0x4B, 0x97, 0x63, 0xB7, 0x00, 0x00, 0x17, 0x02, 0x01, 0x36, 0x68, 0x01, 0x10, 0x07, 0xD7, 0xEC, 0x02, 0x31, 0x05, 0x00, 0x18, 0x09, 0x60, 0x24, 0x68, 0x7F, 0x6D, 0x74, 0x78, 0xA3, 0x1F, 0x0E, 0x99, 0x02, 0x00, 0xFD, 0xD4, 0x07, 0x00, 0x44, 0x6C, 0x6F, 0x63, 0x61, 0xE4, 0xDB, 0xDD, 0xE9, 0x04, 0x00, 0x16, 0xF8, 0x0B, 0x60, 0xA4, 0x6D, 0x7F, 0x61, 0x78, 0x70, 0x00, 0x61, 0x00, 0xC6, 0x01, 0x00, 0xFD, 0xD8, 0x0C, 0x60, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0xE7, 0x35, 0x5B, 0xCA, 0x09, 0x00, 0x02, 0x00, 0x02, 0x4E, 0x70, 0x7F, 0x6F, 0x73, 0x74, 0xFF, 0x9F, 0x00, 0x32, 0x0D, 0x00, 0xFD, 0x48, 0x02, 0x01, 0x70, 0x72, 0x65, 0x70, 0x68, 0x06, 0xEB, 0x8C, 0x85, 0x0B, 0x00, 0xF0, 0x0F, 0x60, 0x07, 0x00, 0x02, 0xBB, 0x00, 0x1E, 0x02, 0x80, 0x7A, 0x02, 0xBC, 0x00, 0xC0, 0x0B, 0xFF, 0x00, 0x00, 0x73, 0x01, 0x33, 0x01, 0x23, 0x03, 0xFF, 0x31, 0x03, 0x37, 0x37, 0x21, 0x17, 0x1E, 0x01, 0xFF, 0x02, 0x59, 0x01, 0x01, 0x59, 0xD5, 0xD6, 0x1E, 0xFF, 0x18, 0x01, 0x3D, 0x18, 0x02, 0xBC, 0xFD, 0x44, 0xFF, 0x02, 0x53, 0xFD, 0xAD, 0xB4, 0x44, 0x44, 0x00, 0xEA, 0x12, 0xA0, 0x4B, 0x05, 0xE0, 0x2C, 0x03, 0x60, 0x13, 0x00, 0x1C, 0xFB, 0x00, 0x25, 0x03, 0x80, 0x11, 0x33, 0x32, 0x16, 0x16, 0xFF, 0x15, 0x14, 0x06, 0x06, 0x07, 0x37, 0x1E, 0x02, 0xFE, 0x00, 0x81, 0x23, 0x27, 0x33, 0x32, 0x36, 0x35, 0x34, 0xEF, 0x26, 0x23, 0x23, 0x35, 0x00, 0x95, 0x4B, 0xF6, 0x4A, 0xFF, 0x61, 0x30, 0x2F, 0x4B, 0x2A, 0x0E, 0x2D, 0x4C, 0xFF, 0x2D, 0x34, 0x65, 0x4A, 0xAA, 0xA1, 0x47, 0x4F, 0xFF, 0x51, 0x47, 0x9F, 0x9C, 0x44, 0x47, 0x47, 0x47, 0xFF, 0x99, 0x02, 0xBC, 0x2F, 0x51, 0x32, 0x36, 0x48, 0xFF, 0x26, 0x04, 0x0A, 0x01, 0x2E, 0x4E, 0x30, 0x35, 0xFF, 0x57, 0x33, 0x46, 0x43, 0x3C, 0x3B, 0x47, 0x43, 0xEF, 0x40, 0x37, 0x35, 0x40, 0x1A, 0x00, 0x30, 0xFF, 0xF4, 0xFF, 0x02, 0x9E, 0x02, 0xC8, 0x00, 0x1D, 0x00, 0x00, 0xFF, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0xFE, 0x07, 0x00, 0x17, 0x23, 0x26, 0x26, 0x23, 0x22, 0x06, 0xDF, 0x06, 0x15, 0x14, 0x16, 0x16, 0x06, 0xD0, 0x37, 0x33, 0xFF, 0x06, 0x06, 0x01, 0x7B, 0x66, 0x95, 0x50, 0x50, 0xFF, 0x95, 0x66, 0x78, 0x96, 0x15, 0x5D, 0x10, 0x62, 0xFF, 0x54, 0x4B, 0x6E, 0x3C, 0x3C, 0x6E, 0x4B, 0x54, 0xFF, 0x62, 0x10, 0x5D, 0x15, 0x96, 0x0C, 0x5B, 0xA3, 0xFF, 0x6C, 0x6C, 0xA3, 0x5B, 0x72, 0x68, 0x41, 0x4F, 0xFF, 0x45, 0x81, 0x5A, 0x5A, 0x81, 0x45, 0x4D, 0x40, 0xD3, 0x65, 0x72, 0x10, 0x00, 0x0C, 0xA1, 0x80, 0x10, 0x00, 0x0A, 0x00, 0xE1, 0x15, 0x0C, 0x89, 0x0C, 0x02, 0x0C, 0x11, 0x0B, 0x91, 0xCE, 0x7B, 0x9F, 0xFF, 0x4D, 0x4D, 0x9F, 0x7B, 0x7A, 0x78, 0x66, 0x78, 0xFB, 0x34, 0x34, 0x00, 0x50, 0x02, 0xBC, 0x55, 0x9D, 0x6E, 0xFF, 0x6C, 0x9C, 0x54, 0x46, 0x43, 0x7D, 0x56, 0x58, 0x33, 0x7E, 0x44, 0x24, 0x20, 0x11, 0x00, 0x01, 0xFC, 0x14, 0x60, 0x14, 0x41, 0xF7, 0x11, 0x21, 0x15, 0x00, 0x25, 0x4B, 0x01, 0xB1, 0xFE, 0xFF, 0xA3, 0x01, 0x3F, 0xFE, 0xC1, 0x01, 0x5D, 0x02, 0xBF, 0xBC, 0x45, 0xF4, 0x44, 0xFA, 0x45, 0x02, 0xC4, 0xF5, 0xFA, 0x17, 0x20, 0x09, 0x02, 0xC8, 0x11, 0x4B, 0x01, 0xAA, 0xFE, 0xDF, 0xAA, 0x01, 0x23, 0xFE, 0xDD, 0x02, 0x80, 0xF6, 0x44, 0x0B, 0xFE, 0xC3, 0x0F, 0x64, 0xBB, 0x0F, 0x60, 0x24, 0xA0, 0x0F, 0x6F, 0x0F, 0x66, 0xFF, 0x23, 0x35, 0x21, 0x11, 0x23, 0x27, 0x31, 0x0E, 0xFF, 0x02, 0x01, 0x78, 0x62, 0x94, 0x52, 0x53, 0x99, 0xFF, 0x68, 0x76, 0x9E, 0x16, 0x61, 0x0E, 0x68, 0x53, 0xFF, 0x4D, 0x73, 0x3E, 0x3E, 0x6F, 0x48, 0x70, 0x72, 0xFF, 0x08, 0xCA, 0x01, 0x20, 0x4D, 0x07, 0x19, 0x41, 0xFF, 0x58, 0x0C, 0x5B, 0xA2, 0x6C, 0x6B, 0xA4, 0x5C, 0xFF, 0x71, 0x65, 0x3F, 0x4A, 0x45, 0x80, 0x59, 0x59, 0xFF, 0x81, 0x44, 0x84, 0x71, 0x42, 0xFE, 0x8A, 0x73, 0x57, 0x29, 0x39, 0x1D, 0x1D, 0x04, 0x5E, 0x20, 0x60, 0x03, 0x20, 0x83, 0xDF, 0x61, 0x11, 0x33, 0x11, 0x21, 0x00, 0x40, 0x03, 0x35, 0xFF, 0x21, 0x15, 0x02, 0x0A, 0x54, 0xFD, 0xED, 0x54, 0xE7, 0x10, 0x01, 0x90, 0x20, 0x32, 0x20, 0x70, 0x01, 0x42, 0x45, 0x99, 0x45, 0x2F, 0xD0, 0x20, 0x41, 0x00, 0x9F, 0x03, 0x42, 0x20, 0x01, 0x11, 0xF3, 0x4B, 0x54, 0x22, 0x41, 0x34, 0xE0, 0x1C, 0xFF, 0xF4, 0x01, 0xBD, 0xAA, 0x25, 0x20, 0x12, 0x00, 0x00, 0x57, 0x1A, 0xE1, 0x33, 0xF6, 0x1A, 0x03, 0x36, 0x35, 0x05, 0x50, 0x14, 0x06, 0xE7, 0x3F, 0xFF, 0x5B, 0x31, 0x55, 0x17, 0x33, 0x2B, 0x2A, 0x31, 0xFF, 0x15, 0x54, 0x67, 0x0C, 0x30, 0x5A, 0x3E, 0x23, 0xFF, 0x39, 0x21, 0x20, 0x37, 0x23, 0x02, 0x03, 0xFD, 0xB7, 0xFD, 0x5E, 0x67, 0x14, 0xA3, 0x02, 0x31, 0x14, 0xA5, 0x33, 0xE9, 0x11, 0x29, 0x10, 0x29, 0x20, 0x07, 0x05, 0xE0, 0x01, 0x24, 0x6A, 0xFF, 0xFE, 0xFC, 0x01, 0x08, 0x66, 0xDE, 0x4E, 0x02, 0xFF, 0xBC, 0xFE, 0xC3, 0x01, 0x3D, 0xFE, 0xE9, 0xFE, 0x9F, 0x5B, 0x01, 0x64, 0x53, 0xFE, 0x36, 0xD0, 0x18, 0x03, 0xE5, 0x72, 0x2C, 0x60, 0x05, 0x08, 0xC3, 0x17, 0xA0, 0x54, 0x01, 0x46, 0x2B, 0x40, 0x5B, 0x87, 0x43, 0x0A, 0xA4, 0x02, 0xFF, 0x2E, 0x40, 0x0F, 0x2A, 0xA2, 0xFF, 0x13, 0x31, 0x13, 0x33, 0x11, 0x23, 0x11, 0x31, 0xFD, 0x03, 0x2E, 0xA0, 0x11, 0x4B, 0x62, 0xF7, 0xF8, 0x63, 0xEF, 0x54, 0xE7, 0x3F, 0xE6, 0x05, 0x50, 0x17, 0x01, 0xE9, 0xFE, 0x2E, 0x50, 0x26, 0xFE, 0x3C, 0x01, 0xC2, 0xFD, 0xDC, 0x5A, 0x03, 0x85, 0x68, 0x08, 0xC6, 0x01, 0x31, 0x11, 0x60, 0x23, 0x00, 0x60, 0xBE, 0x08, 0xC0, 0x75, 0x54, 0x54, 0xFE, 0x8B, 0x31, 0x40, 0xCF, 0x3B, 0x02, 0x31, 0x31, 0x80, 0x31, 0xFD, 0xCF, 0x34, 0xA0, 0x2A, 0x61, 0x9D, 0xD7, 0x2A, 0x60, 0x0F, 0x00, 0x1F, 0x2A, 0x8A, 0x31, 0x82, 0x27, 0xFC, 0x24, 0xE5, 0x2B, 0x14, 0x01, 0x83, 0x65, 0x99, 0x55, 0x55, 0xFF, 0x99, 0x65, 0x67, 0x98, 0x55, 0x55, 0x98, 0x67, 0x7F, 0x4C, 0x73, 0x3F, 0x3F, 0x73, 0x4C, 0x4B, 0x00, 0x61, 0x7E, 0x2A, 0x81, 0x6B, 0xA3, 0x5C, 0x5C, 0xA3, 0x6B, 0x2A, 0xE0, 0x8D, 0x4A, 0x2A, 0xB2, 0x44, 0x44, 0x2B, 0x12, 0x3D, 0x10, 0x37, 0x82, 0x20, 0x9A, 0x3A, 0xE0, 0x0C, 0x2A, 0xEC, 0x23, 0x11, 0x38, 0x20, 0x36, 0x74, 0xE4, 0xFF, 0x53, 0x6B, 0x33, 0x33, 0x6A, 0x54, 0x90, 0x8F, 0xFF, 0x54, 0x48, 0x48, 0x54, 0x8F, 0x02, 0xBC, 0x37, 0xFF, 0x5C, 0x3B, 0x39, 0x5D, 0x38, 0xFE, 0xE0, 0x01, 0xDF, 0x67, 0x4A, 0x3D, 0x41, 0x47, 0x3B, 0xE1, 0x30, 0xFF, 0xD5, 0xA1, 0x0A, 0xA2, 0x03, 0x3C, 0x00, 0x23, 0x35, 0x40, 0x03, 0x33, 0xF3, 0x13, 0x25, 0x0B, 0x0F, 0x0B, 0x0A, 0x02, 0x3D, 0xEB, 0x61, 0xE7, 0xEB, 0xFE, 0xE5, 0x0B, 0x5F, 0x0B, 0x52, 0x5F, 0x01, 0x70, 0x87, 0xFE, 0x90, 0x53, 0x0B, 0xAF, 0x0B, 0xA6, 0x43, 0x23, 0x0B, 0xA3, 0x10, 0xAB, 0x00, 0x19, 0x0B, 0xCC, 0x21, 0x08, 0x10, 0x01, 0x42, 0x76, 0xE2, 0xFF, 0x52, 0x68, 0x32, 0x33, 0x6A, 0x53, 0x8A, 0x01, 0xFF, 0x1E, 0x9A, 0x5E, 0x9F, 0xFE, 0x7F, 0x88, 0x50, 0xEF, 0x4B, 0x49, 0x53, 0x87, 0x0C, 0x71, 0x3A, 0x38, 0x5E, 0xFF, 0x38, 0xFE, 0xDF, 0x01, 0x39, 0xFE, 0xC7, 0x01, 0x5F, 0x63, 0x4E, 0x3D, 0x3E, 0x49, 0x5B, 0xA0, 0x2D, 0x41, 0xA0, 0xE1, 0x16, 0x41, 0xA0, 0x4E, 0x20, 0x41, 0xA2, 0x26, 0xC6, 0x34, 0x2E, 0x02, 0xD5, 0x27, 0x18, 0x28, 0x23, 0x3C, 0x91, 0x26, 0x42, 0xC1, 0x1E, 0x02, 0xFD, 0x17, 0x4A, 0x23, 0x01, 0x2A, 0x4D, 0x72, 0x3E, 0x58, 0xFF, 0x26, 0x49, 0x36, 0x2F, 0x43, 0x23, 0x23, 0x3C, 0xFF, 0x4F, 0x2B, 0x53, 0x4E, 0x35, 0x63, 0x44, 0x43, 0xFF, 0x63, 0x38, 0x58, 0x1E, 0x3D, 0x2E, 0x26, 0x3B, 0xFF, 0x21, 0x1D, 0x37, 0x4A, 0x2D, 0x33, 0x4F, 0x2D, 0xFF, 0x35, 0x68, 0x0C, 0x38, 0x64, 0x42, 0x29, 0x45, 0xFF, 0x29, 0x1F, 0x36, 0x22, 0x29, 0x33, 0x20, 0x19, 0xFF, 0x0E, 0x1C, 0x54, 0x43, 0x39, 0x56, 0x31, 0x32, 0xFF, 0x57, 0x39, 0x1D, 0x38, 0x25, 0x01, 0x1B, 0x32, 0xFF, 0x24, 0x22, 0x2A, 0x1D, 0x18, 0x0F, 0x11, 0x31, 0x9F, 0x4C, 0x3B, 0x32, 0x59, 0x38, 0x31, 0x61, 0x55, 0x01, 0x14, 0xF8, 0x55, 0x02, 0x51, 0x60, 0x39, 0xD0, 0x15, 0x23, 0x11, 0xEF, 0xD1, 0xFF, 0x01, 0xF6, 0xD1, 0x02, 0x77, 0x45, 0x45, 0xFD, 0x2E, 0x5F, 0x90, 0x01, 0x00, 0x44, 0x4C, 0xE0, 0x4C, 0x57, 0x20, 0x47, 0x00, 0xF8, 0x4C, 0xE2, 0x31, 0x71, 0x32, 0x29, 0x06, 0x01, 0x47, 0x48, 0x75, 0xFF, 0x46, 0x54, 0x2D, 0x50, 0x34, 0x35, 0x4E, 0x2C, 0xFF, 0x54, 0x46, 0x76, 0x0C, 0x3A, 0x77, 0x5D, 0x01, 0xFF, 0xBA, 0xFE, 0x45, 0x44, 0x56, 0x28, 0x28, 0x56, 0xFF, 0x44, 0x01, 0xBB, 0xFE, 0x46, 0x5D, 0x77, 0x3A, 0x6A, 0x6B, 0x60, 0x16, 0x5E, 0x20, 0x86, 0x06, 0xA3, 0x61, 0x01, 0x2D, 0x62, 0xFF, 0x01, 0x01, 0x1D, 0xFE, 0xF9, 0x5B, 0xDD, 0xDF, 0x77, 0x59, 0xFE, 0xF9, 0x5B, 0x00, 0x9D, 0x02, 0x63, 0x39, 0x02, 0x06, 0x6B, 0xE0, 0x03, 0xAF, 0x2F, 0xE4, 0x1E, 0xA0, 0x2F, 0xE0, 0x30, 0x21, 0x2F, 0xE1, 0xFF, 0x03, 0xDB, 0xC0, 0x5A, 0x97, 0xAB, 0x5E, 0xA7, 0xBF, 0x99, 0x5A, 0xC4, 0x60, 0xA7, 0xAB, 0x5E, 0x30, 0xA8, 0xBF, 0x02, 0x58, 0xFD, 0xA6, 0x02, 0x5A, 0x5E, 0xB0, 0x43, 0xAB, 0xFD, 0xBD, 0x3E, 0x41, 0x26, 0x64, 0x60, 0x34, 0x61, 0xE0, 0x0D, 0xDA, 0x61, 0xC0, 0x13, 0x03, 0xD3, 0x03, 0x13, 0x62, 0x21, 0x26, 0xD6, 0xFF, 0xD6, 0x5F, 0xAC, 0xA4, 0x5E, 0xD6, 0xD7, 0x5F, 0xFF, 0xAD, 0xA3, 0x01, 0x61, 0x01, 0x5B, 0xFE, 0xE9, 0xFF, 0x01, 0x17, 0xFE, 0xA2, 0xFE, 0xA2, 0x01, 0x1A, 0x2B, 0xFE, 0xE6, 0x75, 0x20, 0x14, 0x67, 0xE0, 0x2F, 0x4E, 0x45, 0x25, 0xF0, 0xFD, 0x23, 0x07, 0x10, 0x11, 0xF8, 0xE4, 0x5F, 0xBC, 0x19, 0xFF, 0xBB, 0x5E, 0xE3, 0x01, 0x0A, 0x01, 0xB2, 0xFE, 0x7F, 0x85, 0x01, 0x7B, 0xFE, 0x4E, 0xFE, 0xF6, 0x1C, 0x41, 0xBA, 0x74, 0xA0, 0xF0, 0x51, 0x04, 0x35, 0x01, 0x21, 0x47, 0x30, 0x01, 0x7F, 0x21, 0x15, 0x2D, 0x01, 0x5D, 0xFE, 0xA8, 0x0F, 0x60, 0xFF, 0xA2, 0x01, 0x62, 0x42, 0x02, 0x31, 0x49, 0x42, 0xD7, 0xFD, 0xCF, 0x49, 0x30, 0x01, 0x33, 0x45, 0xC0, 0xE4, 0x02, 0x9F, 0x04, 0x00, 0x21, 0x00, 0x30, 0x45, 0xE4, 0x60, 0xC1, 0x33, 0x9E, 0x35, 0x93, 0x07, 0x23, 0x3E, 0x02, 0x68, 0x82, 0x51, 0x12, 0x03, 0xBF, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x62, 0x25, 0xEA, 0xFF, 0x3D, 0x52, 0x28, 0x35, 0x61, 0x42, 0x85, 0x1D, 0xFF, 0x37, 0x29, 0x30, 0x46, 0x08, 0x56, 0x06, 0x3D, 0xFF, 0x5E, 0x33, 0x46, 0x5D, 0x2E, 0x4B, 0x05, 0x0A, 0xFF, 0x1F, 0x2A, 0x35, 0x15, 0x23, 0x39, 0x28, 0x15, 0xFF, 0x7E, 0x31, 0x3C, 0x1A, 0x19, 0x31, 0x0C, 0x2B, 0xFF, 0x47, 0x2A, 0x33, 0x47, 0x25, 0x2F, 0x3F, 0x20, 0xFF, 0x30, 0x2F, 0x36, 0x49, 0x27, 0x33, 0x5B, 0x3E, 0xFF, 0xFE, 0xC8, 0x59, 0x15, 0x25, 0x1B, 0x10, 0x47, 0xFF, 0x1D, 0x33, 0x3E, 0x22, 0x03, 0x17, 0x29, 0x1A, 0xDB, 0x1B, 0x28, 0x17, 0x91, 0x00, 0x46, 0x69, 0x40, 0x42, 0x02, 0x79, 0xD0, 0x0E, 0xA0, 0x5A, 0x04, 0x27, 0x31, 0x07, 0x23, 0x53, 0x70, 0xFC, 0x3F, 0x3F, 0x3F, 0x36, 0x4E, 0x2B, 0x45, 0x34, 0x11, 0x07, 0xFF, 0x4C, 0x54, 0x18, 0x5A, 0x42, 0x49, 0x6E, 0x3D, 0xFF, 0x3D, 0x6E, 0x53, 0x31, 0x4C, 0x2B, 0x2B, 0x4C, 0xFF, 0x31, 0x32, 0x4C, 0x2A, 0x2A, 0x4C, 0x0C, 0x19, 0xFF, 0x2A, 0x1C, 0x53, 0x02, 0xD0, 0xFE, 0xD5, 0x27, 0xFF, 0x38, 0x45, 0x77, 0x4C, 0x4C, 0x78, 0x44, 0x49, 0xFF, 0x30, 0x55, 0x3A, 0x39, 0x56, 0x30, 0x30, 0x56, 0xAF, 0x39, 0x3A, 0x55, 0x30, 0x8A, 0x40, 0x31, 0x70, 0x40, 0x0B, 0xA8, 0x0F, 0xA0, 0x45, 0xCB, 0x70, 0x47, 0x1E, 0x0F, 0xB0, 0x36, 0x70, 0x53, 0x29, 0xFF, 0x47, 0x71, 0x40, 0x40, 0x71, 0x47, 0x5A, 0x78, 0xFF, 0x10, 0x56, 0x0A, 0x4E, 0x35, 0x2B, 0x4A, 0x2C, 0xFF, 0x1A, 0x2C, 0x3B, 0x20, 0x24, 0x3A, 0x28, 0x07, 0xFF, 0x56, 0x10, 0x79, 0x0C, 0x42, 0x77, 0x4E, 0x50, 0xFF, 0x76, 0x43, 0x5D, 0x4E, 0x2F, 0x34, 0x2B, 0x56, 0xFF, 0x3F, 0x2F, 0x49, 0x30, 0x19, 0x17, 0x2E, 0x1F, 0x13, 0x4C, 0x5F, 0x45, 0xC1, 0x06, 0x21, 0x2D, 0x0D, 0x29, 0x76, 0x85, 0x4F, 0x71, 0xEC, 0x66, 0x21, 0x4C, 0x4E, 0x24, 0x49, 0x76, 0x10, 0x6F, 0x49, 0x3E, 0xFF, 0x5D, 0x19, 0x54, 0x4C, 0x07, 0x10, 0x32, 0x46, 0xED, 0x24, 0x0C, 0xB2, 0x32, 0x31, 0x0D, 0x12, 0x45, 0x78, 0x4C, 0xFF, 0x4C, 0x77, 0x44, 0x32, 0x2D, 0x01, 0x2B, 0xFD, 0x9F, 0x30, 0x53, 0x19, 0x2B, 0x1B, 0x0D, 0x1B, 0x0D, 0x24, 0x0D, 0x18, 0x1C, 0xC0, 0x84, 0x00, 0x52, 0xEB, 0x14, 0x07, 0x20, 0x50, 0x7D, 0xC4, 0x7D, 0xD6, 0xFE, 0x6E, 0x10, 0x23, 0x47, 0x6D, 0x3E, 0x3D, 0x6F, 0x48, 0xFF, 0x4A, 0x67, 0x37, 0x01, 0xFE, 0x64, 0x01, 0x4B, 0xFF, 0x03, 0x55, 0x40, 0x2B, 0x49, 0x2C, 0x2D, 0x49, 0xFF, 0x2A, 0x35, 0x45, 0x0F, 0x53, 0x0C, 0x3C, 0x59, 0xFE, 0x0D, 0xB0, 0x4F, 0x50, 0x76, 0x42, 0x42, 0x6B, 0x40, 0xFF, 0x0A, 0x16, 0x0E, 0x41, 0x45, 0x4E, 0x27, 0x4B, 0xFF, 0x38, 0x1C, 0x3E, 0x54, 0x2A, 0x2F, 0x28, 0x2D, 0x33, 0x48, 0x29, 0x53, 0xC1, 0x7E, 0x00, 0x01, 0x35, 0x1B, 0x20, 0x48, 0x21, 0xD4, 0x8B, 0x20, 0x23, 0x92, 0x15, 0x84, 0x10, 0x15, 0x6E, 0x72, 0x62, 0x20, 0xFF, 0x3F, 0x2E, 0x39, 0x2C, 0x25, 0x21, 0xA1, 0x01, 0xFF, 0x20, 0x02, 0x46, 0x30, 0x3D, 0x1D, 0x48, 0x1E, 0xFF, 0x26, 0xFD, 0xBC, 0x01, 0xB1, 0x47, 0x47, 0x00, 0x7F, 0x04, 0x00, 0x26, 0xFF, 0x18, 0x02, 0x13, 0x27, 0x60, 0x7F, 0x2D, 0x00, 0x3D, 0x00, 0x49, 0x00, 0x4D, 0x88, 0x67, 0xF3, 0x37, 0x17, 0x87, 0xF6, 0x8E, 0xD1, 0x27, 0x2E, 0x03, 0x27, 0x57, 0x35, 0x37, 0x17, 0x90, 0x40, 0x03, 0x46, 0x54, 0x03, 0x60, 0x7F, 0xFC, 0x91, 0x51, 0x07, 0x50, 0x14, 0x16, 0x37, 0x27, 0x33, 0x15, 0xFF, 0x01, 0x0D, 0x44, 0x69, 0x3A, 0x13, 0x2F, 0x2B, 0xFF, 0x3A, 0x35, 0x20, 0x26, 0x44, 0x2B, 0x2B, 0x3E, 0xFF, 0x22, 0x34, 0x49, 0x3B, 0x50, 0x34, 0x23, 0x0E, 0xFF, 0x61, 0x49, 0x64, 0x0D, 0x0B, 0x14, 0x22, 0x3D, 0xFF, 0x32, 0x45, 0x53, 0x25, 0x2F, 0x62, 0x4E, 0x3F, 0xFF, 0x59, 0x2E, 0x2F, 0x58, 0x3F, 0x3F, 0x58, 0x2E, 0xFF, 0x2E, 0x58, 0x3F, 0x36, 0x3E, 0x3E, 0x36, 0x35, 0xFF, 0x41, 0x40, 0x88, 0x19, 0xCE, 0xE8, 0x23, 0x48, 0xFF, 0x35, 0x17, 0x34, 0x32, 0x14, 0x22, 0x16, 0x39, 0xFF, 0x18, 0x21, 0x2C, 0x16, 0x18, 0x2C, 0x1E, 0x23, 0xFF, 0x2F, 0x04, 0x04, 0x0E, 0x13, 0x18, 0x0D, 0x17, 0xFF, 0x60, 0x1A, 0x5A, 0x23, 0x08, 0x0E, 0x0A, 0x08, 0xFF, 0x04, 0x05, 0x26, 0x40, 0x2C, 0x2B, 0x4D, 0x32, 0xFF, 0x01, 0x86, 0x30, 0x51, 0x32, 0x32, 0x50, 0x31, 0xFF, 0x31, 0x50, 0x32, 0x32, 0x51, 0x30, 0x45, 0x38, 0xFF, 0x36, 0x35, 0x38, 0x38, 0x35, 0x36, 0x38, 0xCE, 0x2B, 0x47, 0x3F, 0x7C, 0xA1, 0x46, 0xA2, 0xC0, 0x02, 0x2C, 0xC0, 0x45, 0x20, 0xC2, 0x7C, 0xA1, 0x31, 0x6B, 0x74, 0x72, 0x50, 0x0A, 0xC2, 0x12, 0x20, 0x46, 0x54, 0xFF, 0x19, 0x5B, 0x36, 0x3A, 0x56, 0x2E, 0x53, 0x40, 0xEF, 0x3D, 0x2B, 0x45, 0x28, 0x2A, 0x80, 0xD3, 0x2D, 0x34, 0xFF, 0x2F, 0x60, 0x49, 0xFE, 0xD4, 0x01, 0x23, 0x4C, 0xBF, 0x4D, 0x2A, 0x4E, 0x39, 0xFE, 0xF5, 0x69, 0xE1, 0x3E, 0x4E, 0xB4, 0xA0, 0xB2, 0x02, 0xD5, 0xB4, 0xA0, 0x76, 0xA3, 0x11, 0x0F, 0xF0, 0xF8, 0x9A, 0xD0, 0xA1, 0xC0, 0xA1, 0xB0, 0x4E, 0x54, 0x2A, 0x19, 0x21, 0xFF, 0x21, 0x19, 0x18, 0x22, 0x22, 0x01, 0xF8, 0xFE, 0xFF, 0x08, 0x02, 0x63, 0x21, 0x19, 0x19, 0x1F, 0x1F, 0xF7, 0x19, 0x19, 0x21, 0x08, 0x03, 0x00, 0x9A, 0x01, 0xF8, 0xB6, 0x84, 0xA5, 0x46, 0x54, 0x02, 0x21, 0xFF, 0xFF, 0x05, 0x02, 0xA2, 0xEF, 0x02, 0x9F, 0x06, 0x26, 0x90, 0x41, 0x00, 0x06, 0x00, 0xFD, 0x50, 0x06, 0x10, 0x02, 0xFF, 0xE5, 0xFF, 0x24, 0x00, 0x2D, 0xB6, 0x06, 0x60, 0x0C, 0x00, 0xB2, 0x40, 0x47, 0xA5, 0xF2, 0x53, 0x83, 0xFB, 0x23, 0x13, 0x06, 0xF8, 0x1B, 0x27, 0x26, 0x20, 0x54, 0xFA, 0x1D, 0x40, 0x64, 0x07, 0x52, 0x21, 0x21, 0xDC, 0x48, 0x1F, 0xDF, 0x25, 0x02, 0x48, 0xFD, 0xB6, 0x1D, 0xB0, 0x03, 0x3F, 0xA8, 0x07, 0xC6, 0x3C, 0x80, 0xBC, 0x80, 0xE7, 0x3C, 0x80, 0x06, 0xA0, 0x20, 0x00, 0x7F, 0x61, 0x03, 0x37, 0x33, 0x03, 0x37, 0x01, 0x8F, 0xB1, 0xFF, 0x01, 0x7C, 0xF0, 0xDB, 0x67, 0xFB, 0x01, 0x01, 0xFF, 0x13, 0xFE, 0x5F, 0x54, 0x01, 0x14, 0xE4, 0xFE, 0x7F, 0xFE, 0x3C, 0xFE, 0xCE, 0x02, 0xD0, 0xFD, 0x2B, 0xA2, 0x60, 0x0B, 0x02, 0x3F, 0xC0, 0x0B, 0x06, 0x01, 0x92, 0x14, 0x82, 0x03, 0x3E, 0x49, 0xE0, 0x85, 0x28, 0xB1, 0x22, 0x17, 0x14, 0x84, 0x00, 0x85, 0x15, 0x09, 0x15, 0xA8, 0x4C, 0xFF, 0x05, 0x18, 0x51, 0x30, 0x27, 0x3F, 0x30, 0x0F, 0xFF, 0x1A, 0x5B, 0x34, 0x3A, 0x57, 0x2F, 0x53, 0x3E, 0xFF, 0x38, 0x27, 0x3E, 0x24, 0x54, 0x3E, 0x39, 0x26, 0xFF, 0x3D, 0x24, 0x01, 0xF8, 0x48, 0x27, 0x2D, 0x15, 0xFF, 0x2B, 0x21, 0x2E, 0x33, 0x2F, 0x5F, 0x49, 0xFE, 0xBF, 0xD3, 0x01, 0x24, 0x4C, 0x4C, 0x29, 0x16, 0xC0, 0xF4, 0x84, 0x00, 0x96, 0x1B, 0xC4, 0x01, 0x51, 0x20, 0x1B, 0xC3, 0x06, 0xCF, 0x06, 0x21, 0x04, 0xFF, 0x18, 0x59, 0x39, 0x3B, 0x56, 0x30, 0x54, 0x43, 0xFF, 0x3D, 0x2A, 0x42, 0x27, 0x01, 0xF8, 0x58, 0x2F, 0xBD, 0x35, 0x05, 0x07, 0x4D, 0x39, 0xFE, 0xF3, 0x3F, 0xE5, 0x21, 0xF8, 0x55, 0xA0, 0x8B, 0xEF, 0x8B, 0xEF, 0x16, 0x01, 0x27, 0x46, 0x70, 0xFF, 0x40, 0x41, 0x71, 0x46, 0x48, 0x6F, 0x41, 0x42, 0xFF, 0x70, 0x47, 0x2B, 0x4A, 0x2E, 0x2D, 0x49, 0x2C, 0xFF, 0x2A, 0x4B, 0x2D, 0x2D, 0x49, 0x0C, 0x41, 0x77, 0xFF, 0x4F, 0x51, 0x77, 0x41, 0x41, 0x77, 0x50, 0x50, 0xF7, 0x77, 0x41, 0x48, 0x46, 0x20, 0x40, 0x55, 0x2B, 0x2B, 0x5F, 0x55, 0x40, 0x3F, 0x56, 0x2B, 0x53, 0x43, 0x24, 0x53, 0x40, 0xC5, 0x04, 0x53, 0x43, 0x57, 0x12, 0x21, 0x5B, 0x14, 0xC3, 0x11, 0x22, 0x26, 0xD7, 0x27, 0x11, 0x13, 0x92, 0x6C, 0x46, 0x45, 0x72, 0x2D, 0x4A, 0x7D, 0x6D, 0x52, 0xE0, 0x4A, 0x3D, 0x5D, 0x19, 0xAA, 0x53, 0x28, 0xFF, 0xDC, 0x02, 0xD4, 0x52, 0x18, 0x2B, 0x1B, 0x46, 0x3C, 0x52, 0xE0, 0x46, 0x71, 0xFE, 0xD1, 0x01, 0x19, 0x46, 0x2B, 0x4D, 0x21, 0x99, 0x24, 0x4D, 0x20, 0x07, 0x04, 0x45, 0x11, 0x06, 0x52, 0x99, 0x66, 0x17, 0xF3, 0x31, 0x37, 0xAE, 0x10, 0x99, 0x7D, 0xD9, 0x18, 0x5B, 0x41, 0x79, 0x4A, 0x4D, 0x62, 0x5A, 0xD0, 0x10, 0x08, 0x4C, 0xFF, 0x4D, 0x38, 0xDF, 0xDC, 0x01, 0x2E, 0x27, 0x37, 0x59, 0xE1, 0x77, 0x45, 0x3F, 0x18, 0x2B, 0x1C, 0x53, 0xFD, 0x2C, 0x07, 0x2D, 0x34, 0xA2, 0xC3, 0x01, 0x59, 0x6A, 0x00, 0x46, 0x22, 0x0E, 0x03, 0x46, 0x30, 0x0E, 0x02, 0xFE, 0x1E, 0x81, 0x06, 0x11, 0x35, 0x4B, 0x30, 0x1F, 0x20, 0xFF, 0x3A, 0x2D, 0x19, 0x01, 0xF8, 0x60, 0x22, 0x30, 0xFF, 0x1A, 0x58, 0x11, 0x26, 0x41, 0x30, 0xFE, 0xFC, 0xAA, 0xE8, 0x00, 0x2B, 0xB3, 0x20, 0xC3, 0x6D, 0x60, 0x2F, 0x64, 0xA4, 0x33, 0xC0, 0x5C, 0xD3, 0xC7, 0xE1, 0x45, 0x30, 0xCE, 0xFB, 0xCE, 0xE1, 0x8C, 0x25, 0x04, 0x3F, 0xFF, 0x5D, 0x37, 0x06, 0x56, 0x05, 0x20, 0x37, 0x28, 0xFF, 0x23, 0x2E, 0x17, 0x1D, 0x38, 0x28, 0x21, 0x40, 0xFF, 0x32, 0x1D, 0x2C, 0x53, 0x37, 0x51, 0x64, 0x09, 0xFF, 0x53, 0x05, 0x37, 0x30, 0x2F, 0x31, 0x1B, 0x35, 0xFF, 0x27, 0x32, 0x52, 0x33, 0x2F, 0x56, 0x0C, 0x2A, 0xFF, 0x4B, 0x33, 0x1A, 0x2C, 0x1B, 0x15, 0x24, 0x15, 0xFF, 0x1F, 0x20, 0x13, 0x07, 0x06, 0x14, 0x21, 0x30, 0xFF, 0x23, 0x2B, 0x43, 0x26, 0x4E, 0x4A, 0x26, 0x2B, 0xFF, 0x26, 0x1F, 0x14, 0x1F, 0x16, 0x07, 0x09, 0x1E, 0x5F, 0x3B, 0x36, 0x2F, 0x46, 0x27, 0xF0, 0xA0, 0x22, 0xED, 0x60, 0x97, 0x60, 0x02, 0x72, 0x7C, 0x01, 0x61, 0x89, 0xC2, 0xDB, 0xF0, 0x37, 0xE3, 0x33, 0x15, 0x52, 0x80, 0x8A, 0x40, 0x52, 0xF0, 0x01, 0x0C, 0x2D, 0xFF, 0x42, 0x23, 0x58, 0x58, 0x0B, 0x49, 0x92, 0x92, 0xFF, 0x26, 0x30, 0x36, 0x1C, 0x43, 0x39, 0x01, 0x19, 0xFF, 0x47, 0x7A, 0x7A, 0x47, 0xFE, 0xE7, 0x2F, 0x21, 0x2E, 0xE6, 0x10, 0x01, 0x00, 0x3D, 0xBF, 0xC0, 0xF8, 0x3C, 0xA0, 0x89, 0xC0, 0x70, 0xBF, 0xC2, 0x8D, 0xC2, 0xBF, 0xD5, 0xCA, 0x70, 0x06, 0x06, 0xFD, 0x2E, 0x40, 0xFF, 0x54, 0x42, 0x3C, 0x2A, 0x44, 0x27, 0x54, 0x4C, 0xFF, 0x05, 0x17, 0x5A, 0x0C, 0x2E, 0x60, 0x48, 0x01, 0xEF, 0x2E, 0xFE, 0xDB, 0x4B, 0x28, 0xA0, 0x38, 0x01, 0x0E, 0x63, 0xFE, 0x08, 0x29, 0xD0, 0xF9, 0x20, 0xEF, 0xE0, 0x01, 0xF7, 0x41, 0x20, 0xFC, 0x94, 0x61, 0x87, 0x74, 0xD7, 0xBF, 0x58, 0x98, 0x99, 0x56, 0x7D, 0xBF, 0x43, 0xD0, 0x59, 0x01, 0xA7, 0xFE, 0x08, 0xC8, 0x21, 0xC6, 0xF2, 0x40, 0x02, 0xE2, 0x43, 0x80, 0x8D, 0xA4, 0x86, 0x50, 0x13, 0x07, 0xFE, 0x8D, 0xA2, 0x33, 0x03, 0xAC, 0x94, 0x54, 0x73, 0x0F, 0xFF, 0x7D, 0x5F, 0x7F, 0x10, 0x72, 0x55, 0x93, 0x56, 0xF7, 0x84, 0x11, 0x84, 0x47, 0x40, 0x57, 0x01, 0xA9, 0xFE, 0x7B, 0x58, 0x01, 0x00, 0x50, 0x08, 0x01, 0xBC, 0xFE, 0xEC, 0x60, 0x86, 0x8A, 0x62, 0x01, 0xDC, 0x47, 0x80, 0x8D, 0xE1, 0x58, 0xE0, 0x21, 0x21, 0x07, 0xFD, 0x17, 0xD4, 0xD0, 0x07, 0x14, 0xAB, 0xAB, 0x5C, 0x88, 0xFF, 0x8A, 0x5A, 0xAB, 0xAB, 0x5A, 0x8A, 0x88, 0xFC, 0x7F, 0xFC, 0xCE, 0xCE, 0xFC, 0xFC, 0xCF, 0xCF, 0xE8, 0x80, 0x25, 0x15, 0x2C, 0x00, 0x17, 0x4A, 0x80, 0xDB, 0xA0, 0x57, 0x90, 0x60, 0x97, 0x43, 0xFF, 0x7D, 0x7B, 0x1D, 0xC6, 0x5B, 0xA4, 0xAC, 0x57, 0xFF, 0xFE, 0xBE, 0xDC, 0x01, 0x14, 0x01, 0xC0, 0xFE, 0x9F, 0x7F, 0x01, 0x81, 0xFD, 0x2C, 0xD2, 0x01, 0xDB, 0x80, 0x01, 0xE9, 0xA0, 0x02, 0xE3, 0x8D, 0x87, 0x24, 0x92, 0x70, 0xEE, 0x01, 0x72, 0xFF, 0xFE, 0xE8, 0x01, 0x1D, 0x45, 0x01, 0x6D, 0x46, 0x27, 0x45, 0xFE, 0x93, 0x57, 0xD1, 0x69, 0xC2, 0xF5, 0x58, 0x22, 0x18, 0x20, 0xA2, 0xA3, 0x81, 0x33, 0x8D, 0x93, 0x6A, 0x02, 0xE1, 0xF0, 0x23, 0xCB, 0x10, 0x01, 0xEE, 0x54, 0xD8, 0x62, 0x4D, 0x4D, 0x6B, 0x00, 0x32, 0x25, 0x25, 0x7F, 0x21, 0x01, 0x2E, 0x54, 0xDA, 0x01, 0x05, 0x55, 0x60, 0xA9, 0x18, 0x55, 0xE0, 0x6B, 0x00, 0x4E, 0x6B, 0xC3, 0x4C, 0x0E, 0x60, 0xB1, 0x8F, 0xFE, 0x4F, 0x02, 0x58, 0x56, 0x76, 0x55, 0x00, 0x70, 0x21, 0xEE, 0xBF, 0x02, 0xD0, 0x04, 0x26, 0x00, 0x20, 0xFF, 0xE2, 0x28, 0x13, 0x01, 0x54, 0xDC, 0x40, 0xCB, 0xA3, 0x7C, 0xCB, 0xAF, 0xCB, 0xAF, 0xCB, 0xA2, 0xFF, 0x57, 0x5C, 0x85, 0x46, 0x46, 0x85, 0x5C, 0x5C, 0xFF, 0x83, 0x46, 0x46, 0x83, 0x5D, 0x3C, 0x5E, 0x36, 0xFF, 0x36, 0x5E, 0x3C, 0x3C, 0x5F, 0x35, 0x35, 0x5F, 0xA8, 0xF6, 0x24, 0xF6, 0x83, 0xCB, 0xAC, 0x01, 0x07, 0x22, 0xED, 0xF6, 0x80, 0x06, 0xF6, 0xF6, 0x61, 0x07, 0x35, 0x37, 0xC0, 0x98, 0x78, 0x94, 0x39, 0x5F, 0x02, 0x5E, 0x1E, 0x3C, 0x40, 0xE3, 0x62, 0x40, 0xF8, 0x80, 0x39, 0x11, 0xFE, 0x40, 0xD3, 0xC0, 0x73, 0x35, 0x3E, 0x2F, 0x50, 0xFD, 0xD4, 0xFE, 0x9D, 0x45, 0x14, 0x0E, 0x03, 0x07, 0x21, 0x15, 0x40, 0xFF, 0x47, 0x81, 0x64, 0x39, 0x1A, 0x39, 0x30, 0x2F, 0xFF, 0x3E, 0x1F, 0x51, 0x01, 0x39, 0x64, 0x40, 0x3F, 0xFF, 0x60, 0x37, 0x29, 0x44, 0x53, 0x57, 0x26, 0x01, 0xFF, 0x55, 0x3B, 0x38, 0x72, 0x71, 0x6C, 0x32, 0x25, 0xFF, 0x3F, 0x28, 0x29, 0x43, 0x28, 0x45, 0x63, 0x34, 0xFF, 0x2F, 0x5C, 0x46, 0x31, 0x62, 0x5D, 0x56, 0x4C, 0xB3, 0x1F, 0x46, 0xF9, 0xE0, 0xA3, 0x60, 0x02, 0x0F, 0xF4, 0xA0, 0x31, 0x42, 0x36, 0x0F, 0x23, 0x2E, 0x10, 0x79, 0x45, 0xA4, 0x06, 0x00, 0x00, 0x07, 0xC2, 0x54, 0xFF, 0x25, 0x43, 0x6D, 0x40, 0x02, 0x55, 0x01, 0x25, 0xFF, 0x46, 0x31, 0x31, 0x42, 0x22, 0x2F, 0x4F, 0x2F, 0xF7, 0x34, 0x34, 0x45, 0xC7, 0xB0, 0x3B, 0x46, 0x05, 0x55, 0xFF, 0x03, 0x38, 0x60, 0x41, 0x44, 0x5C, 0x2F, 0x1A, 0xDF, 0x34, 0x28, 0x29, 0x41, 0x26, 0xC2, 0x70, 0x31, 0x62, 0xFF, 0x49, 0x28, 0x43, 0x28, 0x26, 0x3F, 0x27, 0x31, 0xFF, 0x3D, 0x1D, 0x47, 0x40, 0x38, 0x2E, 0x3E, 0x44, 0xFF, 0x35, 0x39, 0x58, 0x31, 0x30, 0x50, 0x30, 0x24, 0xFF, 0x3F, 0x30, 0x0A, 0x08, 0x2E, 0x4B, 0x31, 0x39, 0xB3, 0x61, 0x3B, 0xE2, 0x60, 0x8E, 0xE0, 0x02, 0x43, 0xFF, 0xE0, 0x0A, 0xFB, 0x00, 0x0E, 0xF6, 0x80, 0x35, 0x21, 0x35, 0x01, 0x33, 0xFD, 0x11, 0x88, 0x70, 0x15, 0x25, 0x21, 0x11, 0x31, 0x01, 0xFF, 0x88, 0xFE, 0x9D, 0x01, 0x54, 0x62, 0x68, 0x68, 0xFF, 0xFE, 0xA7, 0x01, 0x0A, 0x96, 0x41, 0x01, 0xE5, 0x7F, 0xFE, 0x24, 0x4A, 0x96, 0xE0, 0x01, 0x7F, 0xF6, 0xE1, 0x65, 0x41, 0xE5, 0xE0, 0x29, 0xFA, 0x20, 0x92, 0xE4, 0x27, 0x33, 0x87, 0x66, 0x3E, 0xAF, 0xB3, 0x13, 0x21, 0x15, 0x21, 0x07, 0xE7, 0x01, 0xCD, 0xE1, 0xFE, 0x92, 0xD0, 0x37, 0x48, 0x69, 0x3D, 0x08, 0x52, 0x0C, 0xFF, 0x56, 0x43, 0x32, 0x47, 0x27, 0x28, 0x46, 0x2F, 0xDF, 0x39, 0x50, 0x14, 0x51, 0x3A, 0x27, 0x80, 0xCF, 0x27, 0xFF, 0x19, 0x53, 0x37, 0x34, 0x54, 0x3C, 0x21, 0x21, 0xFF, 0x3E, 0x5A, 0x0C, 0x34, 0x5A, 0x38, 0x38, 0x46, 0xFF, 0x2E, 0x50, 0x31, 0x33, 0x4E, 0x2B, 0x32, 0x27, 0xFF, 0x01, 0x7E, 0x49, 0xD7, 0x1D, 0x25, 0x24, 0x42, 0xBF, 0x58, 0x34, 0x33, 0x59, 0x45, 0x27, 0xED, 0x00, 0x37, 0xBA, 0xED, 0x00, 0x35, 0xED, 0x00, 0x23, 0x00, 0x33, 0xED, 0x01, 0x2E, 0x79, 0x02, 0x53, 0xA6, 0xA7, 0x54, 0x07, 0x14, 0x14, 0x15, 0x5C, 0x17, 0xFE, 0xEE, 0x2E, 0x46, 0x4C, 0x68, 0x3E, 0x1D, 0x40, 0x79, 0xFF, 0x55, 0x42, 0x5F, 0x38, 0x06, 0x4E, 0x0A, 0x4D, 0xFF, 0x3B, 0x34, 0x54, 0x31, 0x04, 0x10, 0x39, 0x50, 0xFF, 0x31, 0x3B, 0x68, 0x41, 0x39, 0x6C, 0x50, 0x2E, 0xFF, 0x49, 0x29, 0x29, 0x49, 0x2E, 0x2E, 0x4A, 0x2B, 0xFF, 0x2B, 0x4A, 0x0C, 0x39, 0x5F, 0x78, 0x3E, 0x74, 0xFF, 0xAF, 0x63, 0x33, 0x56, 0x35, 0x38, 0x3D, 0x41, 0xFF, 0x85, 0x67, 0x01, 0x04, 0x02, 0x1F, 0x36, 0x20, 0xFF, 0x38, 0x65, 0x44, 0x3B, 0x6C, 0x44, 0x4A, 0x29, 0xFB, 0x47, 0x2D, 0x49, 0xB0, 0x2A, 0x47, 0x2C, 0x2D, 0x47, 0xCC, 0x75, 0x70, 0xCC, 0xE2, 0x01, 0xF1, 0x24, 0x84, 0xC2, 0xD3, 0x8A, 0x01, 0xFF, 0x11, 0xFE, 0x80, 0x01, 0xD6, 0xFE, 0xF2, 0x02, 0x5F, 0x74, 0x48, 0x3F, 0xFD, 0x83, 0xEE, 0x00, 0x40, 0xF8, 0xA0, 0x7D, 0x20, 0xF8, 0xA0, 0x1D, 0x00, 0x29, 0x00, 0x35, 0x9A, 0xE8, 0xE0, 0xF9, 0x3A, 0x1E, 0x24, 0x99, 0x29, 0x67, 0xF0, 0x99, 0xE6, 0x01, 0x30, 0x44, 0xFF, 0x6C, 0x40, 0x22, 0x3D, 0x28, 0x38, 0x3D, 0x36, 0xFF, 0x63, 0x45, 0x46, 0x63, 0x35, 0x3D, 0x38, 0x29, 0xFF, 0x3D, 0x21, 0x3F, 0x6D, 0x44, 0x4F, 0x4D, 0x55, 0xFF, 0x47, 0x47, 0x55, 0x4E, 0x4E, 0x3F, 0x4A, 0x49, 0xFF, 0x40, 0x3F, 0x49, 0x49, 0x0C, 0x33, 0x5B, 0x3C, 0xFF, 0x2B, 0x4A, 0x37, 0x0B, 0x14, 0x54, 0x31, 0x34, 0xFF, 0x54, 0x32, 0x32, 0x54, 0x34, 0x31, 0x54, 0x14, 0xFF, 0x0B, 0x37, 0x4A, 0x2B, 0x3C, 0x5B, 0x33, 0x4A, 0xFF, 0x49, 0x3C, 0x44, 0x46, 0x46, 0x44, 0x3C, 0x49, 0xFF, 0x01, 0x55, 0x42, 0x34, 0x3B, 0x3C, 0x3C, 0x3B, 0x2B, 0x34, 0x42, 0xFC, 0x20, 0x3F, 0xEB, 0x20, 0x3D, 0x15, 0x67, 0x1C, 0xA7, 0x3F, 0x37, 0x34, 0x34, 0x35, 0x0E, 0x02, 0x6A, 0x27, 0xA4, 0x14, 0xDE, 0xC4, 0x5D, 0x2F, 0x42, 0x5E, 0x37, 0x14, 0xF0, 0x4C, 0x3A, 0xFF, 0x35, 0x52, 0x33, 0x03, 0x0F, 0x3A, 0x4F, 0x31, 0xFF, 0x3B, 0x69, 0x41, 0x3A, 0x6C, 0x4A, 0x4B, 0x68, 0xDF, 0x3F, 0x1C, 0x3F, 0x79, 0x50, 0x15, 0x02, 0x2E, 0x2E, 0xF7, 0x49, 0x2A, 0x2A, 0x09, 0xA0, 0x57, 0x34, 0x38, 0x3D, 0x3F, 0x40, 0x83, 0x65, 0x03, 0x06, 0x03, 0x14, 0xF6, 0x16, 0xA1, 0xFF, 0x73, 0xB0, 0x63, 0x01, 0x51, 0x2A, 0x48, 0x2B, 0x3F, 0x2E, 0x46, 0x28, 0x29, 0x46, 0x2E, 0x5F, 0x80, 0x96, 0xA0, 0xBD, 0x1C, 0x96, 0xA1, 0x01, 0x60, 0x06, 0x07, 0xFA, 0x81, 0xFE, 0x75, 0xA0, 0x97, 0xC0, 0x21, 0xEC, 0xD0, 0x22, 0x01, 0x66, 0x01, 0x20, 0x7D, 0x4C, 0x01, 0x24, 0x1A, 0xFF, 0xFB, 0x01, 0x28, 0x01, 0x22, 0xB8, 0xB0, 0x20, 0x02, 0x42, 0xB5, 0x21, 0x31, 0x01, 0x5C, 0x03, 0x60, 0x4E, 0xEE, 0x03, 0x64, 0x1C, 0x01, 0x60, 0x9B, 0x20, 0xC0, 0x06, 0x06, 0xFC, 0xFF, 0x01, 0x04, 0x61, 0x01, 0x60, 0x01, 0x22, 0x02, 0xC6, 0x78, 0x01, 0x00, 0x04, 0x60, 0x04, 0x41, 0x01, 0x5B, 0x01, 0x28, 0x01, 0x02, 0x38, 0xB4, 0x60, 0x49, 0x21, 0x02, 0x00, 0x31, 0x02, 0xBC, 0x03, 0x00, 0x04, 0x20, 0xE8, 0xFD, 0x00, 0x04, 0x04, 0x42, 0x61, 0x53, 0x42, 0x63, 0x5F, 0x43, 0x5A, 0xFD, 0x2C, 0x04, 0x50, 0x1E, 0x12, 0x2A, 0x2A, 0xFE, 0xA0, 0x6C, 0xFF, 0x20, 0x05, 0x24, 0x00, 0x19, 0x02, 0x20, 0x35, 0x37, 0xD6, 0x22, 0xF4, 0xDF, 0xB2, 0x1D, 0x87, 0x07, 0xBD, 0x60, 0x70, 0x1D, 0x27, 0x20, 0xFF, 0x17, 0x1A, 0x1E, 0x04, 0x43, 0x03, 0x42, 0x3E, 0xFF, 0x26, 0x37, 0x1D, 0x31, 0x2F, 0x51, 0xB5, 0x01, 0xFF, 0x60, 0x30, 0x5C, 0x18, 0x32, 0x22, 0x1D, 0x1E, 0xFF, 0x1F, 0x1C, 0x2E, 0x40, 0x1D, 0x30, 0x1E, 0x29, 0x4F, 0x3D, 0x23, 0x3C, 0x36, 0xFB, 0x21, 0x09, 0x44, 0x00, 0x8A, 0x30, 0x41, 0x53, 0x88, 0x50, 0x77, 0xD3, 0xBA, 0x61, 0x41, 0xBF, 0x23, 0x71, 0x15, 0xDD, 0xE2, 0xFF, 0xA1, 0x3D, 0x45, 0x05, 0x43, 0x03, 0x12, 0x1D, 0xFF, 0x11, 0x1E, 0x23, 0x27, 0x1D, 0x2E, 0x2D, 0x1D, 0xFF, 0x25, 0x22, 0x1D, 0x1C, 0x21, 0x05, 0x3F, 0x03, 0xFF, 0x21, 0x3A, 0x29, 0x36, 0x4A, 0x23, 0x1E, 0x1D, 0xFF, 0x27, 0x48, 0x01, 0x5B, 0x37, 0x34, 0x15, 0x19, 0xFF, 0x0A, 0x1D, 0x19, 0x1B, 0x1D, 0x29, 0x1C, 0x1B, 0xFF, 0x19, 0x1D, 0x19, 0x16, 0x1C, 0x2D, 0x1A, 0x3A, 0xFF, 0x2C, 0x1F, 0x28, 0x08, 0x02, 0x09, 0x29, 0x21, 0xE3, 0x28, 0x39, 0xC9, 0x21, 0x0F, 0xE3, 0x40, 0xC3, 0x53, 0x35, 0x23, 0xFC, 0x51, 0x60, 0x76, 0xB1, 0x15, 0x27, 0x33, 0x35, 0x31, 0xC1, 0xFB, 0xAC, 0xA4, 0x1C, 0x90, 0xA8, 0x6B, 0x01, 0x60, 0x42, 0x7F, 0x32, 0xE8, 0xE4, 0x36, 0x42, 0x78, 0x9C, 0xF9, 0x01, 0xFF, 0x00, 0x02, 0x3B, 0x00, 0x64, 0x02, 0x9F, 0x00, 0xF9, 0x0B, 0x0A, 0xC2, 0xB5, 0xC6, 0x32, 0x14, 0x1E, 0x1E, 0x14, 0xC6, 0x00, 0x40, 0x02, 0x3B, 0x00, 0x72, 0x00, 0xB0, 0x14, 0xE2, 0x00, 0x00, 0x77, 0x51, 0x00, 0x64, 0x74, 0x40, 0x60, 0x00, 0x05, 0x00, 0xE2, 0xFA, 0x00, 0x37, 0x03, 0x01, 0x04, 0x1B, 0x00, 0x52, 0x00, 0x80, 0xFF, 0x00, 0xA3, 0x00, 0xB9, 0x00, 0xCD, 0x01, 0x03, 0xFF, 0x01, 0x1D, 0x01, 0x29, 0x01, 0x48, 0x01, 0x63, 0xFF, 0x01, 0x72, 0x01, 0x8E, 0x01, 0xA5, 0x01, 0xD7, 0xFB, 0x01, 0xFA, 0xFF, 0xC0, 0x5F, 0x02, 0xA8, 0x02, 0xB9, 0xFF, 0x02, 0xDD, 0x02, 0xF1, 0x03, 0x0F, 0x03, 0x2B, 0xFF, 0x03, 0x41, 0x03, 0x57, 0x03, 0x9C, 0x03, 0xD4, 0xFF, 0x04, 0x05, 0x04, 0x3D, 0x04, 0x75, 0x04, 0x92, 0xFF, 0x05, 0x02, 0x05, 0x26, 0x05, 0x42, 0x05, 0x4E, 0xFF, 0x05, 0x59, 0x05, 0x80, 0x05, 0x9A, 0x05, 0xA6, 0xFF, 0x05, 0xE0, 0x06, 0x04, 0x06, 0x36, 0x06, 0x6E, 0xFF, 0x06, 0xA7, 0x06, 0xC2, 0x07, 0x07, 0x07, 0x27, 0xFF, 0x07, 0x4B, 0x07, 0x5E, 0x07, 0x7E, 0x07, 0x96, 0xFF, 0x07, 0xAD, 0x07, 0xC3, 0x07, 0xF6, 0x08, 0x02, 0xFF, 0x08, 0x34, 0x08, 0x44, 0x08, 0x72, 0x08, 0xB8, 0xFF, 0x08, 0xD4, 0x09, 0x0D, 0x09, 0x58, 0x09, 0x6A, 0xFF, 0x09, 0xB8, 0x0A, 0x03, 0x0A, 0x0C, 0x0A, 0x15, 0xFF, 0x0A, 0x1E, 0x0A, 0x27, 0x0A, 0x2F, 0x0A, 0x37, 0xFF, 0x0A, 0x3F, 0x0A, 0x47, 0x0A, 0x58, 0x0A, 0x81, 0xAF, 0x0A, 0xBE, 0x0A, 0xD7, 0x00, 0x20, 0xED, 0x0C, 0x42, 0x04, 0xFF, 0x01, 0x06, 0xFF, 0x95, 0x15, 0xF9, 0x5F, 0x0F, 0xBF, 0x3C, 0xF5, 0x00, 0x03, 0x03, 0xE8, 0x0C, 0x81, 0xE0, 0xF7, 0x79, 0x20, 0x70, 0x00, 0x82, 0xAF, 0x32, 0x47, 0xFF, 0x7F, 0xC2, 0xFE, 0xFC, 0x04, 0x47, 0x03, 0xC7, 0xC2, 0x22, 0xFD, 0x02, 0x0E, 0x63, 0x02, 0x27, 0x00, 0x4B, 0x02, 0x98, 0xEF, 0x00, 0x1E, 0x02, 0x5B, 0x00, 0x80, 0xCD, 0x00, 0x30, 0xAB, 0x02, 0xB0, 0x01, 0x00, 0x35, 0x01, 0x40, 0x17, 0x01, 0x80, 0xF6, 0xFA, 0x01, 0x00, 0xA9, 0x2E, 0x80, 0xEA, 0x00, 0x4B, 0x01, 0xF5, 0xEF, 0x00, 0x1C, 0x02, 0x48, 0x02, 0xC0, 0x0F, 0x00, 0x4B, 0xAB, 0x03, 0x49, 0x03, 0x40, 0xB3, 0x00, 0x80, 0x06, 0x03, 0x00, 0x44, 0xFA, 0x00, 0x84, 0x52, 0x04, 0x80, 0x44, 0x00, 0x2D, 0x02, 0x31, 0xFE, 0x04, 0xC0, 0x8F, 0x00, 0x44, 0x02, 0x9D, 0x00, 0x16, 0xAF, 0x03, 0xC8, 0x00, 0x1B, 0x05, 0x80, 0x26, 0x02, 0x40, 0x14, 0xBB, 0x02, 0x1D, 0x01, 0xC0, 0x20, 0x00, 0x33, 0x93, 0x20, 0x46, 0xBF, 0x02, 0x3C, 0x00, 0x31, 0x02, 0x73, 0x00, 0x40, 0x38, 0xBB, 0x00, 0x31, 0x75, 0x80, 0x15, 0x02, 0x2E, 0x02, 0x40, 0x3F, 0xAA, 0xD5, 0xC0, 0xF0, 0xD1, 0x80, 0xDF, 0xD6, 0x40, 0xDF, 0xD2, 0x00, 0xF3, 0x73, 0xFF, 0xE5, 0xCE, 0x80, 0x00, 0xC1, 0x46, 0x03, 0x7B, 0x03, 0x40, 0x45, 0x3E, 0x03, 0x80, 0x51, 0x03, 0x80, 0x04, 0x01, 0x03, 0xC0, 0x01, 0x04, 0x80, 0xFF, 0x01, 0xF6, 0x00, 0x2B, 0x01, 0x88, 0x00, 0x22, 0xEF, 0x02, 0x3D, 0x00, 0x3D, 0x09, 0x80, 0x18, 0x02, 0xFB, 0xAF, 0x00, 0x18, 0x01, 0xF0, 0x06, 0xC0, 0x2C, 0x32, 0xE0, 0xCA, 0xCF, 0x00, 0x24, 0x02, 0x33, 0x05, 0xC0, 0x00, 0x41, 0xAC, 0x00, 0xFF, 0x30, 0x01, 0x38, 0x00, 0x20, 0x02, 0x40, 0x00, 0xF7, 0x40, 0x02, 0x4F, 0x08, 0x40, 0x5F, 0x00, 0x25, 0x02, 0xFF, 0x62, 0x00, 0x41, 0x02, 0x74, 0x00, 0x37, 0x02, 0xF5, 0x16, 0x0A, 0x40, 0x60, 0x01, 0x80, 0x74, 0x00, 0x3F, 0x00, 0x55, 0xCC, 0x39, 0x60, 0x4A, 0x38, 0xA0, 0x4A, 0x37, 0xE0, 0x41, 0xF0, 0x60, 0xC4, 0x01, 0x0F, 0x02, 0x0A, 0x01, 0xD0, 0x80, 0x22, 0xC2, 0x26, 0xE0, 0x03, 0xE0, 0xEB, 0xFE, 0xCA, 0x18, 0x10, 0x70, 0x16, 0x40, 0xA5, 0x04, 0x47, 0x7C, 0x24, 0x4C, 0x25, 0xE1, 0x04, 0x02, 0x27, 0x01, 0x90, 0x25, 0xE0, 0x5F, 0x00, 0x02, 0x8A, 0x02, 0x58, 0xDF, 0xE0, 0x4B, 0x00, 0x83, 0x1F, 0x01, 0x5E, 0x00, 0x32, 0x01, 0xAC, 0xE0, 0x27, 0x4A, 0x28, 0x2A, 0xBF, 0x47, 0x4F, 0x4F, 0x47, 0x00, 0xC0, 0x88, 0x80, 0x7A, 0xCE, 0x06, 0x43, 0x03, 0xF4, 0x01, 0x38, 0xD0, 0x2A, 0x63, 0x01, 0xF8, 0x02, 0x82, 0x80, 0x00, 0x8A, 0x40, 0xDE, 0x00, 0x1D, 0x22, 0xE1, 0x80, 0xC3, 0x40, 0x2B, 0x43, 0x51, 0x14, 0xF9, 0x00, 0x82, 0xC0, 0xFC, 0x60, 0x08, 0xFD, 0x40, 0x04, 0x8C, 0xA0, 0x7F, 0x39, 0x00, 0x5A, 0x00, 0x69, 0x00, 0x7A, 0xE3, 0x00, 0xFE, 0x03, 0x41, 0x30, 0x00, 0x41, 0x00, 0x61, 0x00, 0x6A, 0xFE, 0xE3, 0xE0, 0x2F, 0x00, 0x09, 0xFF, 0xC0, 0xFF, 0xBA, 0xFB, 0xFF, 0xBC, 0x2F, 0xCB, 0xB8, 0x01, 0xFF, 0x85, 0xB0, 0xBB, 0x04, 0x8D, 0x30, 0xF1, 0x0D, 0x00, 0xA2, 0x30, 0xA1, 0x04, 0xA6, 0x9D, 0x00, 0x00, 0xA8, 0x31, 0x63, 0x00, 0xC0, 0x01, 0x79, 0xA0, 0xA8, 0xEA, 0x01, 0x84, 0x02, 0x7A, 0x60, 0xB6, 0x02, 0x44, 0x03, 0x00, 0x32, 0xFB, 0x00, 0xC4, 0x03, 0x04, 0x04, 0x00, 0x1E, 0x00, 0xF6, 0x9E, 0x03, 0xC4, 0x05, 0x00, 0x3A, 0x01, 0x09, 0xE2, 0x04, 0x80, 0x06, 0x5A, 0x50, 0x20, 0x4E, 0x05, 0x43, 0x01, 0x08, 0x1B, 0x80, 0x6A, 0x00, 0xC4, 0x5F, 0x09, 0x00, 0x0C, 0x01, 0x82, 0x01, 0x84, 0x0D, 0x05, 0x47, 0xAE, 0x03, 0x80, 0x08, 0x01, 0x8E, 0x03, 0x04, 0x1A, 0x02, 0x40, 0x96, 0xFE, 0x03, 0xC4, 0x1B, 0x00, 0x0A, 0x01, 0xA2, 0x00, 0x43, 0xFF, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0xBE, 0x0E, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x9B, 0x80, 0x32, 0xAE, 0x0E, 0x20, 0x31, 0x00, 0x34, 0x9C, 0x20, 0x54, 0x01, 0x20, 0x65, 0xBA, 0x9C, 0xA0, 0x44, 0x59, 0x00, 0x20, 0x00, 0x53, 0x0F, 0x60, 0x6E, 0xEB, 0x00, 0x73, 0x9D, 0xA0, 0x50, 0x03, 0x00, 0x6F, 0x00, 0x6A, 0xBA, 0x01, 0xC0, 0x63, 0x03, 0x22, 0x41, 0x00, 0x75, 0x03, 0xA0, 0x68, 0xAA, 0x04, 0xC0, 0x72, 0x02, 0x02, 0x28, 0x04, 0xA2, 0x74, 0x05, 0xA0, 0x73, 0xAB, 0x00, 0x3A, 0xC7, 0x40, 0x2F, 0x05, 0xC0, 0x69, 0x02, 0x22, 0x75, 0xEF, 0x00, 0x62, 0x00, 0x2E, 0x03, 0x60, 0x6F, 0x00, 0x6D, 0xBA, 0x01, 0x62, 0x6F, 0x08, 0x00, 0x67, 0x00, 0x6C, 0x06, 0x60, 0x66, 0xAA, 0x08, 0xA0, 0x6E, 0x08, 0x00, 0x73, 0xCA, 0x40, 0x64, 0x01, 0xE0, 0x2D, 0xAA, 0x01, 0x28, 0x29, 0x08, 0x2C, 0x52, 0x09, 0x60, 0x67, 0x07, 0x40, 0x6C, 0xAA, 0x18, 0x80, 0x72, 0x0A, 0xA0, 0x2E, 0x19, 0x40, 0x30, 0x0B, 0x20, 0x3B, 0x2F, 0x00, 0x47, 0x00, 0x4F, 0x00, 0x20, 0x47, 0x00, 0xA0, 0x0B, 0x41, 0x22, 0x0B, 0x25, 0x2D, 0x03, 0x2C, 0x0D, 0x0D, 0x05, 0x0B, 0x56, 0x0F, 0x40, 0x0C, 0x81, 0x55, 0x69, 0x09, 0x22, 0x20, 0x06, 0x0A, 0x67, 0x0A, 0x80, 0x74, 0x0B, 0x62, 0x55, 0x6C, 0x10, 0xA0, 0x5B, 0x20, 0xC0, 0x2E, 0x21, 0xE0, 0x2E, 0x8C, 0x00, 0xA7, 0x30, 0x00, 0x5D, 0x07, 0x4F, 0x0A, 0x68, 0x4F, 0x16, 0x80, 0x74, 0x4A, 0x24, 0x60, 0x63, 0x23, 0xC0, 0x6C, 0xB1, 0xE0, 0x06, 0x01, 0x7A, 0x15, 0xE0, 0x21, 0x57, 0x16, 0x20, 0x17, 0xC5, 0x17, 0x61, 0x02, 0x61, 0x49, 0x18, 0x80, 0x02, 0x61, 0xC2, 0x02, 0xE1, 0x52, 0x12, 0xC2, 0x17, 0xA1, 0x2A, 0x63, 0xB5, 0x70, 0xFF, 0x9C, 0xA8, 0x22, 0x80, 0x00, 0x1F, 0x59, 0x03, 0x0C, 0xB7, 0x80, 0x7C, 0xB7, 0x42, 0x12, 0x54, 0xFB, 0xC0, 0x00, 0x21, 0x03, 0x59, 0xC2, 0x07, 0xCE, 0xA0, 0x01, 0xC5, 0x80, 0x52, 0x27, 0xE1, 0x0B, 0x2D, 0xC0, 0x28, 0x41, 0x0F, 0xFD, 0xE0, 0x11, 0xC1, 0xA0, 0x57, 0x01, 0x00, 0x17, 0x00, 0x20, 0x01, 0x6F, 0x20, 0x1B, 0xFF, 0x00, 0x51, 0x1D, 0xFA, 0x00, 0x70, 0x60, 0x99, 0x60, 0x01, 0xA4, 0xC0, 0x25, 0xE7, 0x40, 0x5D, 0x27, 0x1D, 0x20, 0x01, 0x00, 0x2A, 0x6C, 0x00, 0x01, 0x1B, 0xE0, 0xA9, 0x31, 0xAF, 0x01, 0x9B, 0x20, 0x01, 0x8F, 0xA0, 0x36, 0xE9, 0x20, 0x37, 0x53, 0x00, 0x38, 0xFD, 0xE0, 0x32, 0xC1, 0x10, 0xD5, 0x60, 0x01, 0x9D, 0x81, 0xBA, 0x01, 0x20, 0x01, 0x34, 0x60, 0x01, 0x01, 0x19, 0x00, 0x84, 0x1A, 0xFA, 0x62, 0xC2, 0x0A, 0xF9, 0x60, 0x32, 0x00, 0x02, 0x44, 0x46, 0xFF, 0x4C, 0x54, 0x00, 0x0E, 0x6C, 0x61, 0x74, 0x6E, 0xEA, 0xAA, 0x20, 0x04, 0x0D, 0x22, 0xFF, 0x64, 0xC2, 0x01, 0x6B, 0x65, 0xC3, 0x72, 0x6E, 0x37, 0x60, 0x65, 0xA3, 0x04, 0x21, 0x05, 0x83, 0x0A, 0x06, 0xF5, 0x14, 0xEF, 0xA0, 0x6A, 0x02, 0xC2, 0x30, 0x00, 0xBC, 0x00, 0xFF, 0xEA, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x20, 0x01, 0xF7, 0x4E, 0x01, 0x54, 0x64, 0xA0, 0x94, 0x01, 0xA2, 0x01, 0xFD, 0xE0, 0xC7, 0x60, 0x18, 0x02, 0x46, 0x02, 0x70, 0x02, 0x7F, 0xCE, 0x04, 0x1A, 0x02, 0xF8, 0x03, 0x74, 0x89, 0x30, 0xFF, 0x10, 0x03, 0x1E, 0x03, 0x44, 0x03, 0x6E, 0x03, 0xD7, 0x4E, 0x03, 0x64, 0x00, 0x60, 0x6E, 0x01, 0x40, 0x74, 0x03, 0xFF, 0x8A, 0x03, 0x90, 0x03, 0x9E, 0x03, 0xB4, 0x03, 0xFF, 0xBA, 0x03, 0xEC, 0x03, 0xF6, 0x04, 0x10, 0x04, 0xFF, 0x1A, 0x04, 0x20, 0x04, 0x42, 0x04, 0x98, 0x04, 0xFF, 0xBE, 0x04, 0xD4, 0x05, 0x06, 0x05, 0x34, 0x05, 0x97, 0xAE, 0x05, 0xDC, 0xFD, 0x60, 0x0D, 0x0B, 0xE2, 0x5E, 0xE1, 0x06, 0xAA, 0x40, 0xC0, 0x0A, 0x40, 0xA0, 0x05, 0xE0, 0x20, 0x10, 0x41, 0x00, 0x12, 0xAA, 0x15, 0x60, 0x0A, 0xFE, 0xE0, 0x14, 0x72, 0x00, 0x16, 0x9F, 0xE0, 0x0C, 0xAA, 0xCD, 0x00, 0x22, 0xFF, 0xE0, 0x26, 0x12, 0x40, 0x18, 0xA0, 0xC0, 0x30, 0xAB, 0x00, 0x1A, 0x3C, 0x40, 0x36, 0xEE, 0x60, 0x39, 0x43, 0x60, 0x27, 0xFA, 0x29, 0x20, 0x42, 0x30, 0xE0, 0x0B, 0x00, 0x20, 0xFF, 0xEF, 0xFF, 0x00, 0x32, 0xFF, 0xCD, 0x00, 0x39, 0xFF, 0xD8, 0xFF, 0x00, 0x3A, 0xFF, 0xE2, 0x00, 0x3C, 0xFF, 0xEC, 0xBE, 0xEC, 0xA0, 0xED, 0x00, 0x3E, 0xFF, 0xD9, 0x9B, 0x00, 0xDD, 0x3A, 0xA5, 0x00, 0xE6, 0xB8, 0x00, 0xE2, 0x00, 0x42, 0x02, 0x00, 0x1A, 0x80, 0xAF, 0xFF, 0xF4, 0x00, 0x14, 0x03, 0x20, 0x16, 0x02, 0x60, 0x17, 0xBE, 0x02, 0xA0, 0x18, 0xFF, 0xE9, 0x00, 0x19, 0x01, 0xE2, 0xEB, 0xD4, 0xEB, 0xA1, 0x03, 0xC0, 0x04, 0x01, 0x40, 0xD1, 0xC6, 0xE1, 0x00, 0x3B, 0xEA, 0x05, 0xA0, 0x40, 0x05, 0x20, 0x0B, 0x03, 0x60, 0xB9, 0x00, 0x0A, 0xFF, 0xFF, 0xC7, 0x00, 0x1B, 0xFF, 0xDE, 0x00, 0x1D, 0x8A, 0x02, 0xA0, 0x1E, 0x02, 0xE0, 0x1F, 0x03, 0x20, 0x96, 0x80, 0x00, 0x00, 0xEB, 0x2B, 0x00, 0x2D, 0x03, 0xE0, 0x2F, 0x07, 0x80, 0x41, 0x08, 0xC0, 0x21, 0xA0, 0xAA, 0x08, 0x60, 0x07, 0x09, 0x40, 0xE2, 0x09, 0x40, 0xE9, 0x09, 0x04, 0xEB, 0xEA, 0xA3, 0xC0, 0xE4, 0x08, 0x84, 0xE3, 0x4F, 0xE0, 0x32, 0xFF, 0xBD, 0x2A, 0x0B, 0x20, 0xD9, 0x0B, 0x20, 0xE1, 0xF7, 0x80, 0xDE, 0x0A, 0xE0, 0x02, 0x21, 0x15, 0xE3, 0xAF, 0xE0, 0xCF, 0x0A, 0xA0, 0xC7, 0xB0, 0x80, 0x08, 0x61, 0x08, 0x25, 0x56, 0x24, 0xE0, 0xFF, 0xA8, 0x08, 0x20, 0xB3, 0x0B, 0x00, 0xE2, 0x0B, 0x00, 0x55, 0xF4, 0x9D, 0x00, 0xEC, 0x08, 0xE0, 0xE9, 0x08, 0xE0, 0xE3, 0x08, 0xE0, 0x7D, 0xE3, 0x08, 0xE0, 0xE3, 0x00, 0x21, 0xFF, 0xDB, 0x08, 0xE0, 0x55, 0xE3, 0x08, 0xE0, 0xE3, 0xFC, 0xC0, 0xC7, 0x10, 0x20, 0xEF, 0xC7, 0xA1, 0xAA, 0xB5, 0x40, 0x3D, 0x07, 0x40, 0x3E, 0x0A, 0x04, 0x0A, 0x0C, 0xA0, 0xAD, 0xEF, 0x00, 0x2C, 0xFF, 0xCE, 0x13, 0x60, 0xC4, 0x00, 0x34, 0xEA, 0x0E, 0xC0, 0x39, 0x03, 0x80, 0x3B, 0x13, 0x20, 0x3C, 0xFF, 0xEA, 0xAA, 0x13, 0xA0, 0xC4, 0xCA, 0xE0, 0xDE, 0x12, 0xE0, 0xEF, 0x8A, 0x80, 0x0A, 0x52, 0x02, 0x20, 0x32, 0x16, 0x00, 0x0A, 0xA1, 0x3B, 0x14, 0x80, 0x3C, 0x16, 0xC0, 0x57, 0x3D, 0xFF, 0xAA, 0x15, 0xC0, 0xE6, 0xB0, 0xC0, 0xDE, 0xDF, 0x80, 0x55, 0x14, 0xCD, 0xC0, 0xDD, 0x15, 0xC0, 0xE4, 0x05, 0x82, 0xD8, 0x02, 0xE4, 0xA9, 0xD8, 0x02, 0xE4, 0x05, 0x01, 0xCE, 0x18, 0xA0, 0xDE, 0xB3, 0xA0, 0xD8, 0xBA, 0xD0, 0x60, 0xD8, 0x0F, 0xE2, 0x17, 0x00, 0x03, 0x16, 0x20, 0x07, 0xAA, 0x16, 0x60, 0x0F, 0x16, 0xA0, 0x11, 0x16, 0xE0, 0x1B, 0x17, 0xE0, 0x1D, 0x4A, 0x10, 0xA0, 0x1E, 0x10, 0xE0, 0x1F, 0x11, 0x20, 0x15, 0x83, 0xE1, 0x15, 0x80, 0x9D, 0xE1, 0x15, 0x80, 0xEF, 0x00, 0x31, 0x1A, 0x60, 0x15, 0x01, 0x33, 0x3A, 0x1E, 0x00, 0x35, 0x1A, 0xA0, 0x39, 0xFF, 0xD7, 0x1E, 0x84, 0x05, 0xE1, 0x55, 0xD7, 0xB9, 0x80, 0xD9, 0x05, 0xE4, 0xD8, 0x0E, 0x02, 0xAF, 0x21, 0x20, 0x55, 0xD6, 0x08, 0x88, 0xD1, 0x21, 0x20, 0xB6, 0x21, 0x20, 0xD1, 0xBC, 0x20, 0x49, 0xCF, 0xD8, 0xE0, 0x16, 0x41, 0xD9, 0xC6, 0xC0, 0xB3, 0xA1, 0x32, 0x22, 0xC0, 0x2A, 0x22, 0x41, 0x02, 0x24, 0x60, 0xF0, 0xC7, 0xE0, 0xEF, 0x62, 0xC1, 0x24, 0x40, 0x55, 0x34, 0x21, 0xA0, 0x40, 0x24, 0x40, 0x09, 0x1F, 0x60, 0xEC, 0x1F, 0x60, 0x55, 0xEC, 0x1F, 0x60, 0xEC, 0x1F, 0x60, 0xEC, 0x16, 0x80, 0xD8, 0x1F, 0x60, 0x55, 0xEC, 0x1F, 0x60, 0xEC, 0x1F, 0x60, 0xED, 0x26, 0xE0, 0xEC, 0xF8, 0x80, 0x15, 0x26, 0x6E, 0x60, 0x32, 0x41, 0x22, 0x1D, 0xFA, 0x00, 0x9C, 0x41, 0xF9, 0x00, 0xA8, 0xA9, 0x81, 0x57, 0x00, 0xFA, 0x81, 0x23, 0xFB, 0x60, 0x2F, 0x1F, 0xC0, 0x01, 0xBA, 0x2A, 0xE0, 0xF6, 0x9D, 0x40, 0x32, 0xFF, 0xE7, 0x17, 0xE0, 0xEB, 0xAA, 0x2B, 0x40, 0xD8, 0xCF, 0x40, 0xBB, 0x17, 0x22, 0x01, 0x2E, 0xE0, 0x1A, 0xD4, 0xD0, 0x40, 0x77, 0xE1, 0x3B, 0xFE, 0x40, 0x3C, 0x46, 0x22, 0x32, 0xFF, 0x55, 0xE5, 0x0F, 0x62, 0x3A, 0x29, 0x02, 0xD1, 0x2C, 0xA0, 0xEC, 0xF9, 0x40, 0x55, 0x3B, 0x6C, 0x60, 0x0C, 0x29, 0x20, 0xE7, 0x29, 0x20, 0xE7, 0x29, 0x20, 0x55, 0xE7, 0x29, 0x20, 0xE7, 0xFA, 0xA0, 0x14, 0x20, 0x80, 0xEB, 0x29, 0x60, 0x55, 0xE7, 0x29, 0x60, 0xE7, 0x29, 0x60, 0xE6, 0x75, 0x60, 0x03, 0x5C, 0x00, 0xD4, 0x20, 0x61, 0x0A, 0x81, 0x3D, 0x21, 0x62, 0xEF, 0xFC, 0xC0, 0x1B, 0xFF, 0x11, 0xFD, 0x2C, 0xEA, 0x2C, 0xA5, 0x02, 0x41, 0xE2, 0xFD, 0x40, 0x46, 0x60, 0x34, 0xA0, 0x55, 0xE6, 0x7A, 0xC0, 0x01, 0x35, 0xC0, 0x14, 0x25, 0xE0, 0x16, 0x35, 0x40, 0x55, 0x17, 0x36, 0x80, 0x18, 0x18, 0x00, 0x19, 0x1E, 0x62, 0xF6, 0xDB, 0x00, 0x55, 0xF2, 0xC4, 0xC0, 0x03, 0x0D, 0x40, 0x07, 0x0D, 0x80, 0x0F, 0x0D, 0xC0, 0x55, 0x11, 0x0E, 0x00, 0x14, 0x24, 0xC0, 0x16, 0x32, 0xE0, 0x17, 0x37, 0xE0, 0x57, 0x19, 0xFF, 0xD5, 0x33, 0x60, 0xEF, 0x33, 0x60, 0xEF, 0x33, 0x60, 0x15, 0xEF, 0x83, 0x80, 0x03, 0x33, 0x60, 0xEF, 0x33, 0x60, 0x3B, 0xA0, 0xDF, 0x20, 0x85, 0x34, 0xDF, 0x60, 0x39, 0x11, 0x40, 0x09, 0xA1, 0x18, 0x01, 0x34, 0x61, 0x42, 0xA8, 0x12, 0x40, 0x7C, 0xE0, 0x07, 0x82, 0xDE, 0x3A, 0xE0, 0xDB, 0x3A, 0xE0, 0xE2, 0x4A, 0x3A, 0xE0, 0xD8, 0x3A, 0xE0, 0xCF, 0x10, 0xA4, 0x02, 0x61, 0xE3, 0xB1, 0xE0, 0x09, 0x14, 0x3F, 0xA0, 0x02, 0x23, 0xEB, 0x3C, 0xC2, 0x22, 0x21, 0x58, 0x60, 0x07, 0x60, 0x54, 0x3E, 0xA3, 0x08, 0x61, 0xDE, 0x03, 0xC4, 0xD2, 0x32, 0x60, 0xFD, 0x24, 0x80, 0x45, 0xEF, 0x24, 0x80, 0xEF, 0x3E, 0x24, 0x04, 0x83, 0x3E, 0x61, 0xD9, 0x06, 0xE4, 0x94, 0x0B, 0x81, 0x0E, 0x61, 0xD0, 0x41, 0xC0, 0xC5, 0x35, 0x80, 0x02, 0xA1, 0xE6, 0xA8, 0x34, 0x22, 0x44, 0xE1, 0x18, 0x01, 0x1E, 0x44, 0xA0, 0xA9, 0x2C, 0x80, 0xE6, 0xAA, 0x2C, 0x80, 0xE6, 0x2F, 0xA2, 0x0F, 0x46, 0x80, 0x11, 0x46, 0xC0, 0x16, 0xA8, 0x8E, 0xE0, 0x2E, 0x20, 0x42, 0xC4, 0xC5, 0x42, 0xC0, 0xC5, 0x42, 0xC0, 0xC5, 0xBE, 0x0F, 0x62, 0x21, 0xFF, 0xD4, 0x00, 0x29, 0x49, 0x00, 0x2A, 0xAA, 0x49, 0x40, 0x2B, 0x05, 0xA0, 0x2C, 0x45, 0x00, 0x2D, 0x06, 0x20, 0x2E, 0xAE, 0x4A, 0x40, 0x2F, 0xFF, 0xC1, 0x4C, 0x40, 0xF2, 0x7D, 0x60, 0x04, 0x2A, 0x36, 0xC4, 0xE6, 0x4C, 0x80, 0xC5, 0x4C, 0x80, 0xE3, 0xE7, 0x80, 0x4C, 0x41, 0x2A, 0x11, 0x61, 0xE6, 0x48, 0xE2, 0xE2, 0x11, 0x64, 0xDD, 0x18, 0xE4, 0x11, 0x63, 0x42, 0x0D, 0x61, 0x3A, 0x4F, 0xE0, 0x4B, 0x83, 0x0A, 0x81, 0x0D, 0x63, 0xD0, 0x14, 0x44, 0x55, 0xE2, 0x4F, 0x20, 0xD9, 0x4F, 0x20, 0xCD, 0x4F, 0x20, 0xCE, 0x24, 0xE2, 0xF8, 0x4E, 0x21, 0x3D, 0x41, 0x52, 0x43, 0xEF, 0x00, 0x02, 0x05, 0x46, 0x5E, 0x63, 0x61, 0x05, 0x92, 0x06, 0x04, 0xF8, 0x00, 0x17, 0x70, 0xAF, 0x60, 0x71, 0xCF, 0x72, 0xEF, 0xA6, 0x8B, 0x58, 0xE0, 0x00, 0x86, 0xFF, 0xFD, 0x5A, 0xC0, 0x54, 0x75, 0xFF, 0x77, 0xA3, 0xCE, 0xE7, 0x40, 0xCF, 0x78, 0x42, 0xE7, 0x78, 0xA2, 0xA5, 0xDC, 0x79, 0x24, 0xE5, 0x79, 0x0F, 0x05, 0xC6, 0xD8, 0x7B, 0x64, 0xED, 0x82, 0xEB, 0x00, 0xEB, 0x06, 0xA5, 0x7C, 0x0F, 0x61, 0x60, 0x7D, 0x5F, 0x0A, 0x6B, 0xE5, 0x6F, 0xFF, 0xD8, 0xFF, 0xEC, 0x02, 0x81, 0xFF, 0xF5, 0x80, 0x82, 0xDD, 0xB7, 0x51, 0xC0, 0x00, 0xFF, 0xBA, 0xF0, 0x80, 0xD9, 0xFF, 0x95, 0xB1, 0xF0, 0xE0, 0xD6, 0xF1, 0x20, 0x9F, 0x81, 0xAF, 0x0E, 0x66, 0xF1, 0x0A, 0x84, 0x04, 0xF6, 0x84, 0x62, 0xF2, 0x84, 0x4F, 0x02, 0xEF, 0x86, 0x8F, 0x13, 0xCE, 0xC8, 0x12, 0xE0, 0x62, 0x00, 0x89, 0x81, 0xFD, 0x01, 0x05, 0x15, 0xEC, 0xEB, 0xFF, 0xFD, 0xBF, 0x0E, 0x09, 0xFF, 0x9C, 0xFF, 0xC3, 0xFF, 0xE2, 0xAE, 0x0B, 0x82, 0xE2, 0xFF, 0x91, 0x15, 0x64, 0x88, 0x18, 0xC6, 0xA9, 0x2F, 0xFF, 0xCF, 0xFF, 0xB7, 0x0D, 0x42, 0xE5, 0x00, 0x81, 0x19, 0xE1, 0x08, 0x14, 0x41, 0xB6, 0x80, 0x06, 0xA1, 0xAF, 0x03, 0xA0, 0x14, 0x48, 0x70, 0x60, 0x07, 0xE4, 0x02, 0x1D, 0x2C, 0xE3, 0x92, 0xA2, 0x01, 0xAF, 0x17, 0x4F, 0x0B, 0x24, 0x1F, 0x65, 0x1A, 0x27, 0xEF, 0xFF, 0xCD, 0xFF, 0xE7, 0x1E, 0xE1, 0xFF, 0xEF, 0xFF, 0x29, 0xF2, 0x16, 0x61, 0x0E, 0xE6, 0xD9, 0x98, 0x62, 0xD7, 0x98, 0x4F, 0x99, 0x6F, 0x00, 0x26, 0x48, 0x17, 0x0F, 0x9C, 0x5F, 0x9D, 0x7F, 0x9E, 0x9F, 0x15, 0x44, 0x25, 0x67, 0xA1, 0x20, 0x89, 0xEA, 0x2C, 0xEA, 0x26, 0xA1, 0xEE, 0xA2, 0x2F, 0x0E, 0x0D, 0xA4, 0xE4, 0xA6, 0xFB, 0xFF, 0xDC, 0x67, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0xCE, 0xB8, 0x24, 0x61, 0x2E, 0x61, 0x1D, 0x42, 0xBB, 0xFF, 0xCB, 0x01, 0xE2, 0xDE, 0x00, 0x0F, 0x03, 0x04, 0x0F, 0xA8, 0x4F, 0x35, 0x8F, 0xAA, 0x8F, 0xAB, 0xAF, 0x0B, 0x89, 0xAD, 0x8F, 0x02, 0x3A, 0x46, 0xF4, 0x15, 0x0F, 0xB0, 0x6F, 0xB1, 0x8F, 0xB2, 0xAF, 0xB3, 0xCF, 0xB4, 0xEF, 0x20, 0x3C, 0x4F, 0xB7, 0x2F, 0x3B, 0xA9, 0x34, 0xE9, 0x27, 0xC4, 0xEF, 0x44, 0x89, 0x29, 0x03, 0x0E, 0xBB, 0xE2, 0xDF, 0xFF, 0xD7, 0x1B, 0x03, 0x27, 0x26, 0x45, 0x60, 0x39, 0x61, 0x30, 0x28, 0xE4, 0x1D, 0xA4, 0xBE, 0xC4, 0x46, 0x20, 0xFF, 0xFC, 0xBE, 0xEF, 0x05, 0x07, 0x6A, 0x4C, 0x8A, 0xBF, 0x42, 0x40, 0xC8, 0x2F, 0xE1, 0xFF, 0xF4, 0x40, 0xA5, 0x2A, 0x43, 0x02, 0xC7, 0xC3, 0x82, 0xC3, 0x47, 0xE8, 0x02, 0xC0, 0x42, 0xF7, 0x01, 0x55, 0x03, 0x74, 0x42, 0x07, 0xC1, 0xC0, 0x03, 0xC1, 0xA0, 0x0F, 0xE6, 0x20, 0x55, 0x12, 0xC1, 0x00, 0x0B, 0xC0, 0xE0, 0x1F, 0xC1, 0xE0, 0x21, 0xAE, 0x00, 0xA5, 0x18, 0xC0, 0x20, 0x2C, 0xAD, 0xA0, 0xD6, 0x81, 0x20, 0xBF, 0xC2, 0x23, 0x4A, 0xBF, 0xC2, 0x24, 0xDD, 0xE0, 0x3A, 0xAF, 0xC0, 0xC6, 0x81, 0x36, 0xFA, 0x41, 0x10, 0xF3, 0x22, 0xFD, 0xD1, 0xF5, 0x81, 0xFE, 0x51, 0x1A, 0xC7, 0x20, 0x06, 0xE3, 0xFF, 0x31, 0x95, 0x19, 0xF5, 0x40, 0x12, 0xF5, 0xE0, 0x1C, 0xF1, 0x80, 0xC0, 0xE1, 0x13, 0x52, 0xEC, 0xE0, 0x03, 0xC8, 0x84, 0xF8, 0x01, 0x07, 0xFF, 0xE6, 0x1B, 0xC9, 0xC0, 0xAA, 0xCB, 0x21, 0x03, 0xF9, 0xA2, 0x15, 0xC5, 0xA0, 0x16, 0xFE, 0xC2, 0x11, 0x02, 0xFF, 0x20, 0x0B, 0xCA, 0xC2, 0xC7, 0x81, 0x7F, 0x40, 0xFB, 0x42, 0xCE, 0x63, 0x0C, 0xE3, 0x88, 0xCF, 0x43, 0x01, 0x83, 0xFD, 0x01, 0x0C, 0xC9, 0x60, 0x77, 0xE0, 0x07, 0x24, 0x00, 0x50, 0xFD, 0xC0, 0xF7, 0x41, 0x00, 0x21, 0x04, 0xE1, 0x09, 0x05, 0x84, 0x00, 0xD1, 0xA2, 0x94, 0xBF, 0x01, 0x0C, 0x01, 0x02, 0xF6, 0x60, 0x0E, 0xD4, 0x00, 0x09, 0x01, 0x0F, 0x52, 0x07, 0x22, 0x13, 0xD2, 0x60, 0xD6, 0x03, 0x0A, 0xD5, 0xE0, 0xC8, 0xCC, 0x4A, 0xF7, 0x12, 0x00, 0x46, 0xFF, 0xE0, 0x34, 0x00, 0x08, 0x41, 0xFB, 0x5A, 0x45, 0xF1, 0xC0, 0x43, 0x41, 0x54, 0x20, 0x00, 0xF7, 0x42, 0x43, 0x52, 0x00, 0x60, 0x50, 0x4B, 0x41, 0x5A, 0xEE, 0xF2, 0xE0, 0x4D, 0x4F, 0x4C, 0x01, 0x20, 0x52, 0x4F, 0x4D, 0x7A, 0x01, 0x80, 0x54, 0x01, 0xE1, 0x50, 0x54, 0x52, 0x4B, 0xF4, 0x61, 0x04, 0xCF, 0x81, 0x8C, 0x01, 0x02, 0xDA, 0x42, 0x00, 0xE3, 0xDB, 0xA1, 0x00, 0xE5, 0x15, 0x21, 0xFA, 0x01, 0xC1, 0x04, 0xDC, 0x20, 0x06, 0x63, 0x63, 0x6D, 0x70, 0xFB, 0x00, 0x26, 0x00, 0x62, 0x2C, 0x64, 0x6E, 0x6F, 0x6D, 0xFF, 0x00, 0x34, 0x6C, 0x69, 0x67, 0x61, 0x00, 0x3A, 0xFF, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0x40, 0x6E, 0x75, 0x03, 0x6D, 0x72, 0x08, 0x82, 0xE0, 0x41, 0x17, 0x05, 0xE1, 0x21, 0xE3, 0x41, 0xCC, 0xE3, 0xAA, 0x12, 0x05, 0x02, 0xE1, 0x00, 0x0C, 0xFE, 0x60, 0x46, 0xFE, 0x00, 0x6C, 0x4A, 0x1B, 0x02, 0x01, 0x14, 0xA2, 0x0A, 0xE3, 0x42, 0xDC, 0x27, 0x02, 0xFF, 0xA0, 0x01, 0x23, 0x00, 0x62, 0xDF, 0xE1, 0x02, 0x65, 0x12, 0x21, 0xE5, 0x81, 0xE1, 0xE1, 0x03, 0xA5, 0x28, 0x15, 0xE1, 0x02, 0x29, 0x16, 0x21, 0x01, 0xFF, 0xA0, 0x3D, 0x17, 0x02, 0x1A, 0x61, 0x28, 0x1A, 0xA1, 0xE0, 0x41, 0xE2, 0x61, 0x06, 0xEA, 0x40, 0x37, 0xA6, 0xC2, 0xE3, 0x81, 0x52, 0xE5, 0xA1, 0x01, 0xFD, 0xC0, 0xEA, 0xC1, 0x08, 0xEE, 0x22, 0x14, 0xEE, 0x82, 0xFF, 0x2C, 0x00, 0x02, 0x6F, 0x70, 0x73, 0x7A, 0x01, 0xBE, 0xE0, 0xE0, 0x77, 0x67, 0x68, 0x74, 0x01, 0xEB, 0x80, 0x69, 0x27, 0x74, 0x61, 0x6C, 0xE4, 0xA0, 0x19, 0xE1, 0x12, 0xD7, 0x60, 0x0E, 0xA2, 0xE3, 0x01, 0x14, 0xEC, 0x80, 0xF1, 0xA1, 0xE7, 0x80, 0x01, 0x0D, 0x01, 0x65, 0x90, 0xEF, 0x90, 0xBC, 0xF2, 0xA2, 0x1E, 0x40, 0x01, 0x1B, 0xF1, 0x66, 0x01, 0x00
 };
-unsigned char* _fontData = nullptr;
-std::atomic<int> _instanceCnt{0};
+/* The font is decompressed on demand, by the first text resolving the "default" family,
+   and dropped by retrieveFont(). */
+inline unsigned char*& _fontData()
+{
+    static unsigned char* data = nullptr;
+    return data;
+}
 
-inline const void retrieveFont() {
-    if (--_instanceCnt == 0) std::free(_fontData);
+inline void retrieveFont() {
+    delete[] _fontData();
+    _fontData() = nullptr;
 }
 
 inline const char* requestFont() {
-    if (_instanceCnt++ > 0) return reinterpret_cast<const char*>(_fontData);
+    auto& output = _fontData();
+    if (output) return reinterpret_cast<const char*>(output);
 
     const unsigned char* input = COMPRESSED_FONT;
-    _fontData = new unsigned char[DEFAULT_FONT_SIZE];
+    output = new unsigned char[DEFAULT_FONT_SIZE];
     size_t inputPos = 0;
     size_t outputPos = 0;
 
@@ -125,25 +133,37 @@ inline const char* requestFont() {
     LZSS: Lempel-Ziv-Storer-Szymanski compression algorithm
     by James A. Storer and Thomas Szymanski
     */
-    // Obtain font _fontData using LZSS decompression
+    // Obtain font data using LZSS decompression
     while (inputPos < COMPRESSED_FONT_SIZE && outputPos < DEFAULT_FONT_SIZE) {
         unsigned char flags = input[inputPos++];
-        
+
+        //eight literals in a row, the common case of the glyph tables
+        if (flags == 0xFF && inputPos + 8 <= COMPRESSED_FONT_SIZE && outputPos + 8 <= DEFAULT_FONT_SIZE) {
+            memcpy(output + outputPos, input + inputPos, 8);
+            inputPos += 8;
+            outputPos += 8;
+            continue;
+        }
+
         for (int bit = 0; bit < 8 && outputPos < DEFAULT_FONT_SIZE; bit++) {
-            if (flags & (1 << bit)) _fontData[outputPos++] = input[inputPos++];
+            if (flags & (1 << bit)) output[outputPos++] = input[inputPos++];
             else {
                 unsigned short offset = input[inputPos++] << 4;
                 unsigned char lengthOffset = input[inputPos++];
                 offset |= lengthOffset >> 4;
-                unsigned char length = (lengthOffset & 0x0F) + 3;
-                
-                size_t copy_pos = outputPos - offset;
-                for (int i = 0; i < length; i++) _fontData[outputPos++] = _fontData[copy_pos + i];
+                size_t length = (lengthOffset & 0x0F) + 3;
+                if (outputPos + length > DEFAULT_FONT_SIZE) length = DEFAULT_FONT_SIZE - outputPos;
+
+                size_t copyPos = outputPos - offset;
+                //a match not overlapping its own output is copied at once
+                if (offset >= length) memcpy(output + outputPos, output + copyPos, length);
+                else for (size_t i = 0; i < length; i++) output[outputPos + i] = output[copyPos + i];
+                outputPos += length;
             }
         }
     }
 
-    return reinterpret_cast<const char*>(_fontData);
+    return reinterpret_cast<const char*>(output);
 }
 
 #else
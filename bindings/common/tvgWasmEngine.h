@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 the ThorVG project. All rights reserved.
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef _TVG_WASM_ENGINE_H_
+#define _TVG_WASM_ENGINE_H_
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <thorvg.h>
+#include "tvgWasmDefaultFont.h"
+
+/* Module-wide engine context shared by all the canvases. The engine is initialized once by the first canvas,
+   the default font is registered once by the first text using it, and they stay alive when the last canvas is gone, so creating and
+   destroying canvases in quick succession (i.e. a virtualized list) doesn't pay for the engine setup again.
+   The released sw target buffers are pooled for the next canvases as well. Only term() tears it down. */
+
+struct TvgEngineContext
+{
+    struct Buffer
+    {
+        uint8_t* data;
+        size_t capacity;
+    };
+
+    static constexpr size_t POOL_SIZE = 4;  //max pooled buffers
+
+    std::vector<Buffer> pool;
+    uint32_t refCnt = 0;        //live canvases
+    bool initialized = false;
+    bool font = false;          //the default font is registered
+};
+
+inline TvgEngineContext& _engineContext()
+{
+    static TvgEngineContext context;
+    return context;
+}
+
+// called by every canvas instance, the first one initializes the engine
+inline bool retainEngine(uint32_t threads = 0)
+{
+    auto& context = _engineContext();
+    if (!context.initialized) {
+        if (tvg::Initializer::init(threads) != tvg::Result::Success) return false;
+        context.initialized = true;
+    }
+    ++context.refCnt;
+    return true;
+}
+
+// registers the embedded font as the "default" family on its first use, false if the module is built without it
+inline bool loadDefaultFont()
+{
+    auto& context = _engineContext();
+    if (context.font) return true;
+    if (!context.initialized || DEFAULT_FONT_SIZE == 0) return false;
+    if (tvg::Text::load("default", requestFont(), DEFAULT_FONT_SIZE, "ttf", false) != tvg::Result::Success) return false;
+    context.font = true;
+    return true;
+}
+
+inline void releaseEngine()
+{
+    auto& context = _engineContext();
+    if (context.refCnt > 0) --context.refCnt;
+}
+
+// terminates the engine if no canvas is alive, returns false otherwise
+inline bool termEngine()
+{
+    auto& context = _engineContext();
+    if (context.refCnt > 0) return false;
+
+    for (auto& buffer : context.pool) std::free(buffer.data);
+    context.pool.clear();
+
+    if (context.font) {
+        tvg::Text::load("default", nullptr, 0);
+        retrieveFont();
+        context.font = false;
+    }
+    if (context.initialized) {
+        tvg::Initializer::term();
+        context.initialized = false;
+    }
+    return true;
+}
+
+// a sw target buffer of size bytes at least, reuses the smallest pooled one that fits
+inline uint8_t* acquireBuffer(size_t size, size_t& capacity)
+{
+    auto& context = _engineContext();
+    auto best = context.pool.end();
+    for (auto it = context.pool.begin(); it != context.pool.end(); ++it) {
+        if (it->capacity >= size && (best == context.pool.end() || it->capacity < best->capacity)) best = it;
+    }
+    if (best != context.pool.end()) {
+        auto data = best->data;
+        capacity = best->capacity;
+        context.pool.erase(best);
+        return data;
+    }
+    capacity = size;
+    return (uint8_t*)std::malloc(size);
+}
+
+// gives back the buffer of acquireBuffer() to the pool, the smallest one is dropped if it's full
+inline void recycleBuffer(uint8_t* data, size_t capacity)
+{
+    if (!data) return;
+    auto& context = _engineContext();
+    context.pool.push_back({data, capacity});
+    if (context.pool.size() <= TvgEngineContext::POOL_SIZE) return;
+
+    auto smallest = context.pool.begin();
+    for (auto it = context.pool.begin(); it != context.pool.end(); ++it) {
+        if (it->capacity < smallest->capacity) smallest = it;
+    }
+    std::free(smallest->data);
+    context.pool.erase(smallest);
+}
+
+// frees the pooled buffers no canvas is using, returns the freed bytes
+inline size_t trimEngine()
+{
+    auto& context = _engineContext();
+    size_t bytes = 0;
+    for (auto& buffer : context.pool) {
+        bytes += buffer.capacity;
+        std::free(buffer.data);
+    }
+    context.pool.clear();
+    return bytes;
+}
+
+// the bytes of the pooled buffers
+inline size_t pooledBytes()
+{
+    size_t bytes = 0;
+    for (auto& buffer : _engineContext().pool) bytes += buffer.capacity;
+    return bytes;
+}
+
+// the sw target color space by its name: "abgr8888"/"argb8888" are premultiplied, the "s" suffixed ones straight alpha
+inline tvg::ColorSpace colorSpaceOf(const std::string& name)
+{
+    if (name == "abgr8888") return tvg::ColorSpace::ABGR8888;
+    if (name == "argb8888") return tvg::ColorSpace::ARGB8888;
+    if (name == "abgr8888s") return tvg::ColorSpace::ABGR8888S;
+    if (name == "argb8888s") return tvg::ColorSpace::ARGB8888S;
+    return tvg::ColorSpace::Unknown;
+}
+
+#endif //_TVG_WASM_ENGINE_H_
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2025 the ThorVG project. All rights reserved.
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef _TVG_WASM_PNG_ENCODER_H_
+#define _TVG_WASM_PNG_ENCODER_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+/* Minimal PNG encoder of the exported frames, which writes into memory instead of a file.
+   The rows are filtered with the best of None/Sub/Up and compressed by a greedy LZ77 with the fixed
+   Huffman codes of deflate. It's far from the best ratio, but the flat colors of the usual animations
+   shrink well and it's fast enough to run per frame. */
+
+struct TvgPngEncoder
+{
+    std::vector<uint8_t> out;
+
+    // encodes the rgba (straight alpha) pixels, the result is in out
+    void encode(const uint8_t* rgba, uint32_t w, uint32_t h)
+    {
+        out.clear();
+        static const uint8_t signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+        out.insert(out.end(), signature, signature + sizeof(signature));
+
+        uint8_t header[13];
+        be32(header, w);
+        be32(header + 4, h);
+        header[8] = 8;      //bit depth
+        header[9] = 6;      //rgba
+        header[10] = header[11] = header[12] = 0;
+        chunk("IHDR", header, sizeof(header));
+
+        filter(rgba, w, h);
+        deflate();
+        chunk("IDAT", zlib.data(), zlib.size());
+        chunk("IEND", nullptr, 0);
+    }
+
+private:
+    std::vector<uint8_t> rows;       //filtered scanlines
+    std::vector<uint8_t> zlib;
+    std::vector<int32_t> head;       //the last position of a hash
+    std::vector<int32_t> prev;       //the previous position of the same hash
+    uint32_t bits = 0;
+    uint32_t bitCnt = 0;
+
+    static constexpr uint32_t WINDOW = 32768;
+    static constexpr uint32_t HASH_BITS = 15;
+    static constexpr uint32_t MAX_CHAIN = 16;
+
+    static void be32(uint8_t* p, uint32_t v)
+    {
+        p[0] = v >> 24;
+        p[1] = v >> 16;
+        p[2] = v >> 8;
+        p[3] = v;
+    }
+
+    static uint32_t crc(uint32_t c, const uint8_t* p, size_t n)
+    {
+        static uint32_t table[256];
+        if (!table[1]) {
+            for (uint32_t i = 0; i < 256; ++i) {
+                auto v = i;
+                for (int k = 0; k < 8; ++k) v = (v & 1) ? 0xedb88320 ^ (v >> 1) : v >> 1;
+                table[i] = v;
+            }
+        }
+        for (size_t i = 0; i < n; ++i) c = table[(c ^ p[i]) & 0xff] ^ (c >> 8);
+        return c;
+    }
+
+    void chunk(const char* type, const uint8_t* data, size_t size)
+    {
+        uint8_t word[4];
+        be32(word, size);
+        out.insert(out.end(), word, word + 4);
+        auto begin = out.size();
+        out.insert(out.end(), type, type + 4);
+        if (size > 0) out.insert(out.end(), data, data + size);
+        be32(word, crc(0xffffffff, out.data() + begin, out.size() - begin) ^ 0xffffffff);
+        out.insert(out.end(), word, word + 4);
+    }
+
+    // picks the filter of the least sum of the absolute differences per row
+    void filter(const uint8_t* rgba, uint32_t w, uint32_t h)
+    {
+        auto stride = size_t(w) * 4;
+        rows.resize((stride + 1) * h);
+
+        auto dst = rows.data();
+        for (uint32_t y = 0; y < h; ++y, dst += stride + 1) {
+            auto row = rgba + y * stride;
+            auto up = y > 0 ? row - stride : nullptr;
+
+            uint32_t sums[3] = {0, 0, 0};
+            for (size_t i = 0; i < stride; ++i) {
+                auto left = i >= 4 ? row[i - 4] : 0;
+                auto above = up ? up[i] : 0;
+                sums[0] += abs(int8_t(row[i]));
+                sums[1] += abs(int8_t(row[i] - left));
+                sums[2] += abs(int8_t(row[i] - above));
+            }
+            uint8_t type = 0;
+            if (sums[1] < sums[type]) type = 1;
+            if (sums[2] < sums[type]) type = 2;
+
+            dst[0] = type;
+            for (size_t i = 0; i < stride; ++i) {
+                auto left = i >= 4 ? row[i - 4] : 0;
+                auto above = up ? up[i] : 0;
+                dst[i + 1] = row[i] - (type == 1 ? left : type == 2 ? above : 0);
+            }
+        }
+    }
+
+    void put(uint32_t value, uint32_t cnt)
+    {
+        bits |= value << bitCnt;
+        bitCnt += cnt;
+        while (bitCnt >= 8) {
+            zlib.push_back(bits & 0xff);
+            bits >>= 8;
+            bitCnt -= 8;
+        }
+    }
+
+    // the huffman codes go from the most significant bit
+    void code(uint32_t value, uint32_t cnt)
+    {
+        uint32_t reversed = 0;
+        for (uint32_t i = 0; i < cnt; ++i) reversed |= ((value >> i) & 1) << (cnt - 1 - i);
+        put(reversed, cnt);
+    }
+
+    // the fixed code of a literal/length symbol
+    void symbol(uint32_t s)
+    {
+        if (s < 144) code(0x30 + s, 8);
+        else if (s < 256) code(0x190 + s - 144, 9);
+        else if (s < 280) code(s - 256, 7);
+        else code(0xc0 + s - 280, 8);
+    }
+
+    void match(uint32_t length, uint32_t distance)
+    {
+        static const uint16_t lengthBase[] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+        static const uint8_t lengthExtra[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+        static const uint16_t distBase[] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+        static const uint8_t distExtra[] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+        uint32_t i = 28;
+        while (lengthBase[i] > length) --i;
+        symbol(257 + i);
+        put(length - lengthBase[i], lengthExtra[i]);
+
+        uint32_t d = 29;
+        while (distBase[d] > distance) --d;
+        code(d, 5);
+        put(distance - distBase[d], distExtra[d]);
+    }
+
+    static uint32_t hash(const uint8_t* p)
+    {
+        return ((p[0] << 16 | p[1] << 8 | p[2]) * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    void deflate()
+    {
+        auto src = rows.data();
+        auto n = uint32_t(rows.size());
+
+        zlib.clear();
+        zlib.reserve(n / 4 + 64);
+        zlib.push_back(0x78);
+        zlib.push_back(0x01);
+        bits = bitCnt = 0;
+
+        //a single final block of the fixed codes
+        put(1, 1);
+        put(1, 2);
+
+        head.assign(1 << HASH_BITS, -1);
+        prev.resize(WINDOW);
+
+        uint32_t i = 0;
+        while (i < n) {
+            uint32_t best = 0, distance = 0;
+            if (i + 3 <= n) {
+                auto h = hash(src + i);
+                auto limit = std::min(n - i, 258u);
+                auto candidate = head[h];
+                for (uint32_t chain = 0; candidate >= 0 && i - candidate <= WINDOW - 1 && chain < MAX_CHAIN; ++chain) {
+                    auto p = src + candidate;
+                    uint32_t len = 0;
+                    while (len < limit && p[len] == src[i + len]) ++len;
+                    if (len > best) {
+                        best = len;
+                        distance = i - candidate;
+                        if (len == limit) break;
+                    }
+                    auto older = prev[candidate % WINDOW];
+                    if (older >= candidate) break;
+                    candidate = older;
+                }
+            }
+
+            auto step = best >= 3 ? best : 1;
+            if (best >= 3) match(best, distance);
+            else symbol(src[i]);
+
+            //index the covered positions for the next matches
+            for (uint32_t k = 0; k < step; ++k, ++i) {
+                if (i + 3 > n) continue;
+                auto h = hash(src + i);
+                prev[i % WINDOW] = head[h];
+                head[h] = i;
+            }
+        }
+        symbol(256);
+        if (bitCnt > 0) put(0, 8 - bitCnt);
+
+        //adler32
+        uint32_t a = 1, b = 0;
+        for (uint32_t k = 0; k < n; ) {
+            auto end = std::min(n, k + 5552);
+            for (; k < end; ++k) {
+                a += src[k];
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+        }
+        uint8_t word[4];
+        be32(word, (b << 16) | a);
+        zlib.insert(zlib.end(), word, word + 4);
+    }
+};
+
+#endif //_TVG_WASM_PNG_ENCODER_H_
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 the ThorVG project. All rights reserved.
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _TVG_WASM_STATS_H_
+#define _TVG_WASM_STATS_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <thorvg.h>
+#include <emscripten.h>
+#include <emscripten/bind.h>
+
+/* Per-phase frame timings over a rolling window and the rendering counters.
+   It's off by default, a disabled instance costs a branch per phase. */
+
+struct TvgStats
+{
+    enum Phase : uint8_t {Frame = 0, Update, Draw, Sync, Upload, PhaseCnt};
+
+    struct Samples
+    {
+        static constexpr uint32_t SIZE = 120;   //rolling window, 2 seconds at 60 fps
+        float values[SIZE];
+        uint32_t cnt = 0;                       //total number of the samples
+
+        void push(float ms)
+        {
+            values[cnt++ % SIZE] = ms;
+        }
+
+        // min, avg, p95, max in milliseconds
+        emscripten::val report() const
+        {
+            auto result = emscripten::val::object();
+            auto n = std::min(cnt, SIZE);
+            float sorted[SIZE];
+            std::copy(values, values + n, sorted);
+            std::sort(sorted, sorted + n);
+
+            float sum = 0.0f;
+            for (uint32_t i = 0; i < n; ++i) sum += sorted[i];
+
+            result.set("min", n > 0 ? sorted[0] : 0.0f);
+            result.set("avg", n > 0 ? sum / n : 0.0f);
+            result.set("p95", n > 0 ? sorted[std::min(n - 1, uint32_t(n * 0.95f))] : 0.0f);
+            result.set("max", n > 0 ? sorted[n - 1] : 0.0f);
+            return result;
+        }
+    };
+
+    Samples phases[PhaseCnt];
+    uint32_t frames = 0;        //rendered frames
+    uint32_t paints = 0;        //updated paints
+    double bytes = 0;           //rasterized bytes
+    bool enabled = false;
+
+    double begin() const
+    {
+        return enabled ? emscripten_get_now() : 0.0;
+    }
+
+    void end(Phase phase, double begin)
+    {
+        if (enabled) phases[phase].push(float(emscripten_get_now() - begin));
+    }
+
+    // a phase measured by the caller (i.e. the upload in JS)
+    void record(Phase phase, double ms)
+    {
+        if (enabled) phases[phase].push(float(ms));
+    }
+
+    void count(tvg::Paint* paint)
+    {
+        if (!enabled || !paint) return;
+        auto accessor = std::unique_ptr<tvg::Accessor>(tvg::Accessor::gen());
+        accessor->set(paint, [](const tvg::Paint* paint, void* data) -> bool {
+            ++*static_cast<uint32_t*>(data);
+            return true;
+        }, &paints);
+    }
+
+    void reset()
+    {
+        for (auto& phase : phases) phase.cnt = 0;
+        frames = paints = 0;
+        bytes = 0;
+    }
+
+    emscripten::val report(uint32_t reallocs) const
+    {
+        static const char* names[PhaseCnt] = {"frame", "update", "draw", "sync", "upload"};
+
+        auto result = emscripten::val::object();
+        for (int i = 0; i < PhaseCnt; ++i) result.set(names[i], phases[i].report());
+        result.set("frames", frames);
+        result.set("paints", paints);
+        result.set("bytes", bytes);
+        result.set("reallocs", reallocs);
+        return result;
+    }
+};
+
+#endif //_TVG_WASM_STATS_H_
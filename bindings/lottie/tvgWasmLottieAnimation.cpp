@@ -21,11 +21,50 @@
  */
 
 #include "config.h"
+
+/* THORVG_WASM_ENGINE_SW/GL/WG specializes the binding for a single engine (see meson_options.txt): the other engines
+   are compiled out and the engine calls are bound statically, without the virtual dispatch. */
+#if defined(THORVG_WASM_ENGINE_SW) + defined(THORVG_WASM_ENGINE_GL) + defined(THORVG_WASM_ENGINE_WG) > 1
+    #error "The binding can be specialized for a single engine only"
+#endif
+#if defined(THORVG_WASM_ENGINE_GL) || defined(THORVG_WASM_ENGINE_WG)
+    #undef THORVG_SW_RASTER_SUPPORT
+#endif
+#if defined(THORVG_WASM_ENGINE_SW) || defined(THORVG_WASM_ENGINE_WG)
+    #undef THORVG_GL_RASTER_SUPPORT
+#endif
+#if defined(THORVG_WASM_ENGINE_SW) || defined(THORVG_WASM_ENGINE_GL)
+    #undef THORVG_WG_RASTER_SUPPORT
+#endif
+//the specialized builds register the api of the players only, i.e. no TvgLottieBatch
+#if defined(THORVG_WASM_ENGINE_SW) || defined(THORVG_WASM_ENGINE_GL) || defined(THORVG_WASM_ENGINE_WG)
+    #define THORVG_WASM_SPECIALIZED
+#endif
+
+//the frame export renders with a sw canvas, THORVG_WASM_NO_EXPORT leaves it out (see meson_options.txt)
+#if defined(THORVG_SW_RASTER_SUPPORT) && !defined(THORVG_WASM_NO_EXPORT)
+    #define THORVG_WASM_EXPORT
+#endif
+
+#include <cfloat>
+#include <cmath>
+#include <cctype>
+#include <cstring>
+#include <list>
 #include <thorvg_lottie.h>
 #include <emscripten.h>
 #include <emscripten/bind.h>
+#include <emscripten/heap.h>
+#ifdef __EMSCRIPTEN_PTHREADS__
+    #include <emscripten/threading.h>
+#endif
 #include "tvgPicture.h"
-#include "tvgWasmDefaultFont.h"
+#include "tvgWasmEngine.h"
+#include "tvgWasmAssetCache.h"
+#include "tvgWasmStats.h"
+#ifdef THORVG_WASM_EXPORT
+    #include "tvgWasmPngEncoder.h"
+#endif
 
 using namespace emscripten;
 using namespace std;
@@ -33,17 +72,65 @@ using namespace tvg;
 
 EMSCRIPTEN_DECLARE_VAL_TYPE(ArrayBuffer);
 EMSCRIPTEN_DECLARE_VAL_TYPE(Float32Array);
+EMSCRIPTEN_DECLARE_VAL_TYPE(Int32Array);
+EMSCRIPTEN_DECLARE_VAL_TYPE(Uint32Array);
 EMSCRIPTEN_DECLARE_VAL_TYPE(AssetResolverCallback);
 
 static const char* NoError = "None";
 
+//the size of the preallocated pthread pool (see meson_options.txt)
+#ifndef THORVG_WASM_THREADS
+    #ifdef __EMSCRIPTEN_PTHREADS__
+        #error "THORVG_WASM_THREADS is required by the pthread build, it'd rasterize on a single thread otherwise"
+    #endif
+    #define THORVG_WASM_THREADS 0
+#endif
+
 static bool isValidProperty(const val& obj, const char* propName) {
     return obj.hasOwnProperty(propName) && !obj[propName].isUndefined() && !obj[propName].isNull();
 }
 
+//the GL/WG engines find their canvas by the selector, this makes an OffscreenCanvas (i.e. in a worker) findable as well
+EM_JS(void, bindCanvas, (const char* selector, EM_VAL canvas), {
+    specialHTMLTargets[UTF8ToString(selector)] = Emval.toValue(canvas);
+});
+
+/* uploads the rect (x, y, w, h) of the pixels (stride in pixels) straight from the wasm memory into a texture of the caller,
+   a WebGLTexture with its WebGL2RenderingContext or a GPUTexture with its GPUDevice. full (re)specifies the whole texture. */
+EM_JS(bool, uploadTexture, (EM_VAL context, EM_VAL texture, const uint8_t* pixels, int stride, int x, int y, int w, int h, bool full), {
+    var target = Emval.toValue(context);
+    var dest = Emval.toValue(texture);
+    var offset = pixels + (y * stride + x) * 4;
+    if (target.queue) {
+        if (dest.width < x + w || dest.height < y + h) return false;
+        target.queue.writeTexture({texture: dest, origin: {x: x, y: y}}, HEAPU8, {offset: offset, bytesPerRow: stride * 4, rowsPerImage: h}, {width: w, height: h});
+        return true;
+    }
+    target.bindTexture(target.TEXTURE_2D, dest);
+    target.pixelStorei(target.UNPACK_ROW_LENGTH, stride);
+    if (full) target.texImage2D(target.TEXTURE_2D, 0, target.RGBA8, w, h, 0, target.RGBA, target.UNSIGNED_BYTE, HEAPU8, offset);
+    else target.texSubImage2D(target.TEXTURE_2D, 0, x, y, w, h, target.RGBA, target.UNSIGNED_BYTE, HEAPU8, offset);
+    target.pixelStorei(target.UNPACK_ROW_LENGTH, 0);
+    return true;
+});
+
 struct TvgEngineMethod
 {
-    virtual ~TvgEngineMethod() {}
+    uint32_t reallocs = 0;    //reallocations of the target buffer
+    size_t scratch = SIZE_MAX;  //bytes the target buffer may keep beyond the size in use
+    ColorSpace cs = ColorSpace::ABGR8888S;  //the pixel format of the sw target
+    bool retained = false;    //holds the shared engine context
+
+    virtual ~TvgEngineMethod()
+    {
+        if (retained) releaseEngine();
+    }
+
+    bool retain(uint32_t threads = 0)
+    {
+        return (retained = retainEngine(threads));
+    }
+
     virtual Canvas* init(string&) = 0;
     virtual void resize(Canvas* canvas, uint32_t w, uint32_t h) = 0;
     virtual ArrayBuffer output(uint32_t w, uint32_t h)
@@ -51,42 +138,120 @@ struct TvgEngineMethod
         return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
     }
 
-    void loadFont() {
-        Text::load("default", requestFont(), DEFAULT_FONT_SIZE, "ttf", false);
+    //the rows [y, y + h) of the target buffer
+    virtual ArrayBuffer output(uint32_t w, uint32_t y, uint32_t h)
+    {
+        return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
+    }
+
+    //the target buffer if it's accessible by the cpu
+    virtual uint8_t* pixels()
+    {
+        return nullptr;
+    }
+
+    //the rendered frame as an ImageBitmap, if the engine renders offscreen
+    virtual val bitmap(uint32_t w, uint32_t h)
+    {
+        return val::undefined();
+    }
+
+    //the bytes of the target buffers in the wasm memory
+    virtual size_t footprint()
+    {
+        return 0;
+    }
+
+    //frees the target buffers, the next resize() allocates them again. The canvas must not draw until then
+    virtual void trim() {}
+
+    //the pixel format of the target buffer, false if the engine doesn't render to the cpu memory
+    virtual bool colorSpace(ColorSpace value)
+    {
+        return false;
+    }
+
+    //renders into the given framebuffer/texture of the caller instead of the canvas, undefined goes back to the canvas
+    virtual bool attach(val target)
+    {
+        return false;
     }
 };
 
 #ifdef THORVG_SW_RASTER_SUPPORT
 
-struct TvgSwEngine : TvgEngineMethod
+struct TvgSwEngine final : TvgEngineMethod
 {
     uint8_t* buffer = nullptr;
+    size_t capacity = 0;      //allocated buffer size in bytes
 
     ~TvgSwEngine()
     {
-        std::free(buffer);
-        Initializer::term();
-        retrieveFont();
+        recycleBuffer(buffer, capacity);
+    }
+
+    static uint32_t threads()
+    {
+#ifdef __EMSCRIPTEN_PTHREADS__
+        //the calling thread joins the rasterizing, don't request more workers than the pool size
+        auto cores = emscripten_num_logical_cores();
+        return std::min(uint32_t(THORVG_WASM_THREADS), uint32_t(cores > 1 ? cores - 1 : 1));
+#else
+        return 0;
+#endif
     }
 
     Canvas* init(string&) override
     {
-        Initializer::init();
-        loadFont();
+        if (!retain(threads())) return nullptr;
         return SwCanvas::gen(EngineOption::None);
     }
 
     void resize(Canvas* canvas, uint32_t w, uint32_t h) override
     {
-        std::free(buffer);
-        buffer = (uint8_t*)std::malloc(w * h * sizeof(uint32_t));
-        static_cast<SwCanvas*>(canvas)->target((uint32_t *)buffer, w, w, h, ColorSpace::ABGR8888S);
+        //grow only within the scratch limit, the pixels stay at the same address otherwise
+        auto size = w * h * sizeof(uint32_t);
+        if (size > capacity || capacity - size > scratch) {
+            recycleBuffer(buffer, capacity);
+            buffer = acquireBuffer(size, capacity);
+            ++reallocs;
+        }
+        static_cast<SwCanvas*>(canvas)->target((uint32_t *)buffer, w, w, h, cs);
     }
 
     ArrayBuffer output(uint32_t w, uint32_t h) override
     {
         return ArrayBuffer(val(typed_memory_view(w * h * 4, buffer)));
     }
+
+    ArrayBuffer output(uint32_t w, uint32_t y, uint32_t h) override
+    {
+        return ArrayBuffer(val(typed_memory_view(w * h * 4, buffer + w * y * 4)));
+    }
+
+    uint8_t* pixels() override
+    {
+        return buffer;
+    }
+
+    size_t footprint() override
+    {
+        return capacity;
+    }
+
+    void trim() override
+    {
+        //back to the allocator, not to the pool
+        std::free(buffer);
+        buffer = nullptr;
+        capacity = 0;
+    }
+
+    bool colorSpace(ColorSpace value) override
+    {
+        cs = value;
+        return true;
+    }
 };
 
 #endif
@@ -103,15 +268,25 @@ static bool adapterRequested = false;
 static bool deviceRequested = false;
 static bool initializationFailed = false;
 
-struct TvgWgEngine : TvgEngineMethod
+EM_JS(WGPUTexture, importTexture, (EM_VAL texture), {
+    return WebGPU.importJsTexture(Emval.toValue(texture));
+});
+
+EM_JS(EM_VAL, exportDevice, (WGPUDevice device), {
+    return Emval.toHandle(WebGPU.getJsObject(device));
+});
+
+struct TvgWgEngine final : TvgEngineMethod
 {
     WGPUSurface surface{};
+    WGPUTexture texture{};      //the attach()ed target of the caller
+    WGPUTexture warmTexture{};  //the texture the taken over warmup() canvas targets till the first resize()
 
     ~TvgWgEngine()
     {
+        if (texture) wgpuTextureRelease(texture);
+        if (warmTexture) wgpuTextureRelease(warmTexture);
         wgpuSurfaceRelease(surface);
-        Initializer::term();
-        retrieveFont();
     }
 
     Canvas* init(string& selector) override
@@ -126,14 +301,39 @@ struct TvgWgEngine : TvgEngineMethod
         surfaceDesc.nextInChain = &canvasDesc.chain;
         surface = wgpuInstanceCreateSurface(instance, &surfaceDesc);
 
-        Initializer::init();
-        loadFont();
+        if (!retain()) return nullptr;
+
+        //the renderer of the warmup() canvas has the pipelines made already, the first player takes it over
+        if (spare) {
+            auto canvas = spare;
+            warmTexture = spareTexture;
+            spare = nullptr;
+            spareTexture = nullptr;
+            releaseEngine();    //held by warmup() for the spare canvas, this engine holds it now
+            return canvas;
+        }
         return WgCanvas::gen();
     }
 
     void resize(Canvas* canvas, uint32_t w, uint32_t h) override
     {
-        if (canvas) static_cast<WgCanvas*>(canvas)->target(device, instance, surface, w, h, ColorSpace::ABGR8888S);
+        if (!canvas) return;
+        if (texture) static_cast<WgCanvas*>(canvas)->target(device, instance, texture, w, h, ColorSpace::ABGR8888S, 1);
+        else static_cast<WgCanvas*>(canvas)->target(device, instance, surface, w, h, ColorSpace::ABGR8888S);
+
+        if (warmTexture) {
+            wgpuTextureRelease(warmTexture);
+            warmTexture = nullptr;
+        }
+    }
+
+    /* a GPUTexture of the device() in rgba8unorm, of the resolution() size, with the RENDER_ATTACHMENT,
+       TEXTURE_BINDING, STORAGE_BINDING, COPY_SRC and COPY_DST usages */
+    bool attach(val target) override
+    {
+        if (texture) wgpuTextureRelease(texture);
+        texture = (target.isUndefined() || target.isNull()) ? nullptr : importTexture(target.as_handle());
+        return true;
     }
 
     static int init()
@@ -178,36 +378,202 @@ struct TvgWgEngine : TvgEngineMethod
         return 0;
     }
 
+    // the warmup() canvas no player has taken over
+    static void drop()
+    {
+        if (!spare) return;
+        delete(spare);
+        wgpuTextureRelease(spareTexture);
+        spare = nullptr;
+        spareTexture = nullptr;
+        releaseEngine();
+    }
+
     static void term()
     {
         wgpuDeviceRelease(device);
         wgpuAdapterRelease(adapter);
         wgpuInstanceRelease(instance);
+        warmed = false;
+    }
+
+    /* Draws a scene exercising the fills, strokes, gradients, masks, blendings and compositions once into an
+       offscreen texture of the shared device, so that their shaders and pipelines are compiled before the first
+       on-screen frame of a player pays for it. ThorVG keeps the pipelines per renderer, so the canvas is kept
+       as the spare one for the next player to take over (and the browser caches the shaders for the others). */
+    static int warmup()
+    {
+        if (warmed) return 0;
+
+        auto ret = init();
+        if (ret != 0) return ret;
+
+        constexpr uint32_t SIZE = 64;
+        const WGPUTextureDescriptor textureDesc {
+            .label = { "ThorVG Warmup", WGPU_STRLEN },
+            .usage = WGPUTextureUsage_RenderAttachment | WGPUTextureUsage_TextureBinding | WGPUTextureUsage_StorageBinding | WGPUTextureUsage_CopySrc | WGPUTextureUsage_CopyDst,
+            .dimension = WGPUTextureDimension_2D,
+            .size = { SIZE, SIZE, 1 },
+            .format = WGPUTextureFormat_RGBA8Unorm,
+            .mipLevelCount = 1,
+            .sampleCount = 1
+        };
+        auto texture = wgpuDeviceCreateTexture(device, &textureDesc);
+        if (!texture) return 1;
+
+        if (!retainEngine()) {
+            wgpuTextureRelease(texture);
+            return 1;
+        }
+
+        auto canvas = WgCanvas::gen();
+        if (canvas && canvas->target(device, instance, texture, SIZE, SIZE, ColorSpace::ABGR8888S, 1) == Result::Success) {
+            Fill::ColorStop stops[2] = {{0.0f, 255, 0, 0, 255}, {1.0f, 0, 0, 255, 128}};
+
+            auto solid = Shape::gen();
+            solid->appendRect(0, 0, SIZE, SIZE);
+            solid->fill(255, 255, 255, 255);
+            solid->strokeWidth(2);
+            solid->strokeFill(0, 0, 0, 255);
+
+            auto linear = Shape::gen();
+            linear->appendCircle(SIZE / 2, SIZE / 2, SIZE / 3, SIZE / 3);
+            auto lgrad = LinearGradient::gen();
+            lgrad->linear(0, 0, SIZE, SIZE);
+            lgrad->colorStops(stops, 2);
+            linear->fill(lgrad);
+
+            auto radial = Shape::gen();
+            radial->appendRect(8, 8, SIZE / 2, SIZE / 2, 4, 4);
+            auto rgrad = RadialGradient::gen();
+            rgrad->radial(SIZE / 2, SIZE / 2, SIZE / 2, SIZE / 2, SIZE / 2, 0);
+            rgrad->colorStops(stops, 2);
+            radial->fill(rgrad);
+            radial->blend(BlendMethod::Multiply);
+
+            auto mask = Shape::gen();
+            mask->appendCircle(SIZE / 2, SIZE / 2, SIZE / 4, SIZE / 4);
+            mask->fill(0, 0, 0, 255);
+            radial->mask(mask, MaskMethod::Alpha);
+
+            auto clipper = Shape::gen();
+            clipper->appendRect(0, 0, SIZE / 2, SIZE);
+
+            auto scene = Scene::gen();
+            scene->push(linear);
+            scene->push(radial);
+            scene->opacity(128);
+            scene->clip(clipper);
+
+            canvas->push(solid);
+            canvas->push(scene);
+            if (canvas->draw(true) == Result::Success && canvas->sync() == Result::Success) {
+                canvas->remove();
+                spare = canvas;
+                spareTexture = texture;
+                warmed = true;
+                return 0;
+            }
+        }
+        delete(canvas);
+        wgpuTextureRelease(texture);
+        releaseEngine();
+
+        warmed = true;
+        return 0;
     }
 
+    static bool warmed;
+    static Canvas* spare;
+    static WGPUTexture spareTexture;
 };
+
+bool TvgWgEngine::warmed = false;
+Canvas* TvgWgEngine::spare = nullptr;
+WGPUTexture TvgWgEngine::spareTexture = nullptr;
 #endif
 
 
 #ifdef THORVG_GL_RASTER_SUPPORT
 
 #include <emscripten/html5_webgl.h>
+#include <GLES3/gl3.h>
 
-struct TvgGLEngine : TvgEngineMethod
+/* The single hidden WebGL2 context shared by the "gl-shared" engines. Browsers cap the live contexts
+   (~16) and drop the oldest ones beyond it, so the players of a grid render into their own framebuffer
+   of this context instead, and the frame is handed to the visible canvas as an ImageBitmap. */
+static const char* SHARED_GL_CANVAS = "#thorvg-gl-shared";
+
+struct TvgSharedGL
+{
+    intptr_t context = 0;
+    uint32_t refCnt = 0;
+    uint32_t width = 0;     //the size of the shared canvas
+    uint32_t height = 0;
+};
+
+static TvgSharedGL sharedGL;
+
+EM_JS(void, createSharedCanvas, (const char* selector), {
+    specialHTMLTargets[UTF8ToString(selector)] = new OffscreenCanvas(1, 1);
+});
+
+EM_JS(void, resizeSharedCanvas, (const char* selector, int w, int h), {
+    var canvas = specialHTMLTargets[UTF8ToString(selector)];
+    canvas.width = w;
+    canvas.height = h;
+});
+
+EM_JS(EM_VAL, transferSharedCanvas, (const char* selector), {
+    return Emval.toHandle(specialHTMLTargets[UTF8ToString(selector)].transferToImageBitmap());
+});
+
+//gives a WebGLFramebuffer of the caller an id of the emscripten GL objects, the engine targets it by the id
+EM_JS(GLuint, importFramebuffer, (EM_VAL framebuffer), {
+    var fbo = Emval.toValue(framebuffer);
+    var id = GL.getNewId(GL.framebuffers);
+    fbo.name = id;
+    GL.framebuffers[id] = fbo;
+    return id;
+});
+
+EM_JS(void, releaseFramebuffer, (GLuint id), {
+    GL.framebuffers[id] = null;
+});
+
+struct TvgGLEngine final : TvgEngineMethod
 {
     intptr_t context = 0;
+    GLuint fbo = 0;         //the target of the shared context
+    GLuint texture = 0;
+    GLuint external = 0;    //the attach()ed framebuffer of the caller
+    bool shared;
+
+    explicit TvgGLEngine(bool shared = false) : shared(shared) {}
 
     ~TvgGLEngine()
     {
-        if (context) {
-            Initializer::term();
-            emscripten_webgl_destroy_context(context);
-            context = 0;
+        if (!context) return;
+
+        //the gl objects and the engine (the last one terminates the gl renderer) go while the context is alive
+        emscripten_webgl_make_context_current(context);
+        if (external) releaseFramebuffer(external);
+        if (fbo) glDeleteFramebuffers(1, &fbo);
+        if (texture) glDeleteTextures(1, &texture);
+        if (retained) {
+            releaseEngine();
+            retained = false;
+        }
+
+        if (shared) {
+            if (--sharedGL.refCnt > 0) return;
+            sharedGL = TvgSharedGL();
         }
-        retrieveFont();
+        emscripten_webgl_destroy_context(context);
+        context = 0;
     }
 
-    Canvas* init(string& selector) override
+    static intptr_t createContext(const char* selector)
     {
         EmscriptenWebGLContextAttributes attrs{};
         attrs.alpha = true;
@@ -219,354 +585,1946 @@ struct TvgGLEngine : TvgEngineMethod
         attrs.minorVersion = 0;
         attrs.enableExtensionsByDefault = true;
 
-        context = emscripten_webgl_create_context(selector.c_str(), &attrs);
-        if (context == 0) return nullptr;
+        return emscripten_webgl_create_context(selector, &attrs);
+    }
+
+    Canvas* init(string& selector) override
+    {
+        if (shared) {
+            if (!sharedGL.context) {
+                createSharedCanvas(SHARED_GL_CANVAS);
+                sharedGL.context = createContext(SHARED_GL_CANVAS);
+                if (sharedGL.context == 0) return nullptr;
+            }
+            context = sharedGL.context;
+            ++sharedGL.refCnt;
+        } else {
+            context = createContext(selector.c_str());
+            if (context == 0) return nullptr;
+        }
 
         emscripten_webgl_make_context_current(context);
 
-        if (Initializer::init() != Result::Success) return nullptr;
-        loadFont();
+        if (!retain()) return nullptr;
 
         return GlCanvas::gen();
     }
 
     void resize(Canvas* canvas, uint32_t w, uint32_t h) override
     {
-        if (canvas) static_cast<GlCanvas*>(canvas)->target((void*)context, 0, w, h, ColorSpace::ABGR8888S);
-    }
-};
-#endif
+        if (!canvas) return;
 
+        if (shared && !external) {
+            emscripten_webgl_make_context_current(context);
+            if (!fbo) {
+                glGenFramebuffers(1, &fbo);
+                glGenTextures(1, &texture);
+            }
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            ++reallocs;
+        }
 
-class __attribute__((visibility("default"))) TvgLottieAnimation
-{
-public:
-    ~TvgLottieAnimation()
+        static_cast<GlCanvas*>(canvas)->target((void*)context, external ? external : fbo, w, h, ColorSpace::ABGR8888S);
+    }
+
+    /* a WebGLFramebuffer of the engine's context, i.e. made by getContext("webgl2") of the same canvas,
+       with a color attachment of the resolution() size */
+    bool attach(val target) override
     {
-        delete(animation);
-        delete(canvas);
-        delete(engine);
+        if (external) releaseFramebuffer(external);
+        external = (target.isUndefined() || target.isNull()) ? 0 : importFramebuffer(target.as_handle());
+        return true;
     }
 
-    explicit TvgLottieAnimation(string engine = "sw", string selector = "")
+    /* blits the framebuffer of this engine to the shared canvas and takes it as an ImageBitmap. The shared canvas
+       grows to the largest player only, the frame is the top-left w x h of the bitmap */
+    val bitmap(uint32_t w, uint32_t h) override
     {
-        errorMsg = NoError;
+        if (!shared || !fbo || external || w == 0 || h == 0) return val::undefined();
+
+        emscripten_webgl_make_context_current(context);
+
+        if (sharedGL.width < w || sharedGL.height < h) {
+            sharedGL.width = std::max(sharedGL.width, w);
+            sharedGL.height = std::max(sharedGL.height, h);
+            resizeSharedCanvas(SHARED_GL_CANVAS, sharedGL.width, sharedGL.height);
+        }
+
+        //the bottom-left origin of gl, the top rows of the bitmap are the last rows of the framebuffer
+        auto top = int(sharedGL.height - h);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        glBlitFramebuffer(0, 0, w, h, 0, top, w, top + h, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        return val::take_ownership(transferSharedCanvas(SHARED_GL_CANVAS));
+    }
+};
+#endif
+
+
+//the engine type the binding calls, the final class of the specialized engine binds them statically
+#if defined(THORVG_WASM_ENGINE_SW)
+    using TvgEngine = TvgSwEngine;
+#elif defined(THORVG_WASM_ENGINE_GL)
+    using TvgEngine = TvgGLEngine;
+#elif defined(THORVG_WASM_ENGINE_WG)
+    using TvgEngine = TvgWgEngine;
+#else
+    using TvgEngine = TvgEngineMethod;
+#endif
+
 
+static TvgEngine* engineGen(const string& engine)
+{
 #ifdef THORVG_SW_RASTER_SUPPORT
-        if (engine == "sw") this->engine = new TvgSwEngine;
+    if (engine == "sw") return new TvgSwEngine;
 #endif
 #ifdef THORVG_GL_RASTER_SUPPORT
-        if (engine == "gl") this->engine = new TvgGLEngine;
+    if (engine == "gl") return new TvgGLEngine;
+    if (engine == "gl-shared") return new TvgGLEngine(true);
 #endif
 #ifdef THORVG_WG_RASTER_SUPPORT
-        if (engine == "wg") this->engine = new TvgWgEngine;
+    if (engine == "wg") return new TvgWgEngine;
 #endif
+    return nullptr;
+}
 
-        if (!this->engine) {
-            errorMsg = "Invalid engine";
-            return;
-        }
-
-        canvas = this->engine->init(selector);
 
-        if (!canvas) {
-            errorMsg = "Unsupported!";
-            return;
-        }
+//the engine of the name with its canvas on the selector, errorMsg tells the failure
+static Canvas* engineInit(TvgEngine*& engine, const string& name, string& selector, string& errorMsg)
+{
+    engine = engineGen(name);
 
-        animation = LottieAnimation::gen();
-        if (!animation) errorMsg = "Invalid animation";
+    if (!engine) {
+        errorMsg = "Invalid engine";
+        return nullptr;
     }
 
-    string error()
-    {
-        return errorMsg;
+    auto canvas = engine->init(selector);
+    if (!canvas) errorMsg = "Unsupported!";
+    return canvas;
+}
+
+
+static const char* filetypeOf(const string& mimetype)
+{
+    if (mimetype == "json") return "lottie+json";
+    return mimetype.c_str();
+}
+
+
+//calls match() with the value of each "key": in the lottie data, true if any of them matches
+template<typename Match>
+static bool scanKey(const string& data, const char* key, Match match)
+{
+    auto len = strlen(key);
+    for (auto pos = data.find(key); pos != string::npos; pos = data.find(key, pos + len)) {
+        auto p = data.c_str() + pos + len;
+        while (isspace(uint8_t(*p))) ++p;
+        if (*p != ':') continue;
+        ++p;
+        while (isspace(uint8_t(*p))) ++p;
+        if (match(p)) return true;
     }
+    return false;
+}
 
-    Float32Array size()
+
+//true if a layer has effects ("ef") or layer styles ("sy"), i.e. blur or drop shadow drawn beyond the paint bounds
+static bool hasEffects(const string& data)
+{
+    auto filled = [](const char* p) {
+        if (*p != '[') return false;
+        ++p;
+        while (isspace(uint8_t(*p))) ++p;
+        return *p != ']';
+    };
+    return scanKey(data, "\"ef\"", filled) || scanKey(data, "\"sy\"", filled);
+}
+
+
+//true if the lottie document has a text layer ("ty": 5), which may fall back to the default font
+static bool hasTextLayer(const string& data)
+{
+    return scanKey(data, "\"ty\"", [](const char* p) { return p[0] == '5' && !isdigit(uint8_t(p[1])) && p[1] != '.'; });
+}
+
+
+/* The default font is decompressed and registered only for the documents that may use it. The lottie loader
+   doesn't report the missing fonts, so it's decided ahead of the loading, once per module: after the font is
+   registered by a document, the others aren't scanned anymore. */
+static void prepareFont(const string& data)
+{
+    if (DEFAULT_FONT_SIZE == 0 || _engineContext().font) return;
+    if (hasTextLayer(data)) loadDefaultFont();
+}
+
+
+/* LRU list of the rendered frames within a memory budget. Optionally the frames are run-length encoded,
+   which pays off for the mostly transparent or flat colored canvases of the usual loaders. */
+struct TvgFrameCache
+{
+    struct Frame
     {
-        return Float32Array(val(typed_memory_view(2, psize)));
+        float no;
+        uint32_t width;
+        uint32_t height;
+        uint8_t quality;
+        bool packed;
+        bool served;             //fetched at least once since it's stored
+        vector<uint32_t> data;   //pixels or (count, pixel) pairs if packed
+    };
+
+    list<Frame> frames;          //most recently used first
+    vector<uint32_t> spare;      //the storage of the last evicted frame, for the next one
+    vector<uint32_t> packing;    //the run-length encoding in progress
+    size_t budget = 0;           //in bytes, 0 to disable
+    size_t used = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    bool compress = false;
+    bool full = false;           //the frames in play don't fit in, the cached ones are kept as they are
+
+    static size_t bytesOf(const Frame& frame)
+    {
+        return frame.data.capacity() * sizeof(uint32_t);
     }
 
-    float duration()
+    void clear()
     {
-        if (!canvas || !animation) return 0;
-        return animation->duration();
+        frames.clear();
+        vector<uint32_t>().swap(spare);
+        used = 0;
+        full = false;
     }
 
-    float totalFrame()
+    //evicts the least recently used frames for the bytes, false if it'd evict a frame never served (i.e. a longer loop)
+    bool reserve(size_t bytes, bool served = true)
     {
-        if (!canvas || !animation) return 0;
-        return animation->totalFrame();
+        while (!frames.empty() && used + bytes > budget) {
+            auto& victim = frames.back();
+            if (!served && !victim.served) return false;
+            used -= bytesOf(victim);
+            spare = std::move(victim.data);
+            frames.pop_back();
+        }
+        return true;
     }
 
-    float curFrame()
+    Frame* find(float no, uint32_t w, uint32_t h, uint8_t quality)
     {
-        if (!canvas || !animation) return 0;
-        return animation->curFrame();
+        for (auto it = frames.begin(); it != frames.end(); ++it) {
+            if (it->no == no && it->width == w && it->height == h && it->quality == quality) {
+                frames.splice(frames.begin(), frames, it);
+                return &frames.front();
+            }
+        }
+        return nullptr;
     }
 
-    bool load(string data, string mimetype, uint32_t width, uint32_t height)
+    // copies the cached frame into the buffer, false if it's not cached
+    bool fetch(uint8_t* buffer, float no, uint32_t w, uint32_t h, uint8_t quality)
     {
-        errorMsg = NoError;
-
-        if (!canvas) return false;
-
-        if (data.empty()) {
-            errorMsg = "Invalid data";
+        auto frame = find(no, w, h, quality);
+        if (!frame) {
+            ++misses;
             return false;
         }
+        ++hits;
+        frame->served = true;
 
-        canvas->remove();
+        if (!frame->packed) {
+            memcpy(buffer, frame->data.data(), w * h * sizeof(uint32_t));
+            return true;
+        }
 
-        delete(animation);
-        animation = LottieAnimation::gen();
-        animation->picture()->origin(0.5f, 0.5f);  //center-aligned
+        auto dst = reinterpret_cast<uint32_t*>(buffer);
+        for (size_t i = 0; i < frame->data.size(); i += 2) {
+            dst = std::fill_n(dst, frame->data[i], frame->data[i + 1]);
+        }
+        return true;
+    }
 
-        string filetype = mimetype;
-        if (filetype == "json") {
-            filetype = "lottie+json";
+    void store(const uint8_t* buffer, float no, uint32_t w, uint32_t h, uint8_t quality)
+    {
+        //the LRU would evict every frame before it's served again, it'd only cost an allocation and a copy per frame
+        if (full) return;
+
+        auto src = reinterpret_cast<const uint32_t*>(buffer);
+        auto cnt = w * h;
+
+        auto packed = false;
+        if (compress) {
+            packing.clear();
+            for (uint32_t i = 0; i < cnt && packing.size() < cnt; ) {
+                auto j = i + 1;
+                while (j < cnt && src[j] == src[i]) ++j;
+                packing.push_back(j - i);
+                packing.push_back(src[i]);
+                i = j;
+            }
+            //worth only if it's smaller than the raw pixels
+            packed = packing.size() < cnt;
         }
 
-        animation->picture()->resolver(resolver.func, &resolver.data);
+        auto size = packed ? packing.size() : size_t(cnt);
+        auto bytes = size * sizeof(uint32_t);
+        if (bytes > budget) return;
 
-        if (animation->picture()->load(data.c_str(), data.size(), filetype.c_str()) != Result::Success) {
-            errorMsg = "load() fail";
-            return false;
+        if (!reserve(bytes, false)) {
+            full = true;
+            return;
         }
 
-        animation->picture()->size(&psize[0], &psize[1]);
+        Frame frame = {no, w, h, quality, packed, false, {}};
 
-        /* need to reset size to calculate scale in Picture.size internally before calling resize() */
-        this->width = 0;
-        this->height = 0;
+        //the evicted storage of about the same size, without the allocation
+        if (spare.capacity() >= size && spare.capacity() <= size + size / 4) frame.data = std::move(spare);
+        spare = {};
 
-        resize(width, height);
+        if (packed) frame.data.assign(packing.begin(), packing.end());
+        else frame.data.assign(src, src + cnt);
 
-        if (canvas->push(animation->picture()) != Result::Success) {
-            errorMsg = "push() fail";
-            return false;
-        }
+        used += bytesOf(frame);
+        frames.push_front(std::move(frame));
+    }
+};
 
-        updated = true;
 
-        return true;
-    }
+/* Trades the effect quality first and then the render resolution for the frame time, to keep update() and the
+   rasterization within the target on the slow devices. They come back step by step once there is enough headroom. */
+struct TvgAdaptive
+{
+    static constexpr uint32_t LEVELS = 5;
+    static constexpr uint32_t SETTLE = 30;       //frames to measure a level before changing it again
+    static constexpr float HEADROOM = 0.5f;      //raises the level back below this share of the target
 
-    ArrayBuffer render()
+    float target = 0.0f;                         //frame time in milliseconds, 0 to disable
+    float average = 0.0f;                        //moving average of the frame time
+    uint32_t level = 0;
+    uint32_t frames = 0;                         //measured frames since the last change
+
+    // the highest quality allowed at the level
+    uint8_t quality(uint8_t preferred) const
     {
-        errorMsg = NoError;
+        static const uint8_t caps[LEVELS] = {100, 25, 0, 0, 0};
+        return std::min(preferred, caps[level]);
+    }
 
-        if (!canvas || !animation) return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
+    // the render resolution relative to the requested size
+    float scale() const
+    {
+        static const float scales[LEVELS] = {1.0f, 1.0f, 1.0f, 0.75f, 0.5f};
+        return scales[level];
+    }
 
-        if (!updated) return engine->output(width, height);
+    void reset()
+    {
+        average = 0.0f;
+        level = 0;
+        frames = 0;
+    }
 
-        if (canvas->draw(true) != Result::Success) {
-            errorMsg = "draw() fail";
-            return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
-        }
+    // feeds the time of a rendered frame, true if the level is changed
+    bool measure(float ms)
+    {
+        if (target <= 0.0f) return false;
 
-        canvas->sync();
+        average = (frames == 0) ? ms : average * 0.9f + ms * 0.1f;
+        if (++frames < SETTLE) return false;
 
-        updated = false;
+        if (average > target && level + 1 < LEVELS) ++level;
+        else if (average < target * HEADROOM && level > 0) --level;
+        else return false;
+
+        frames = 0;
+        return true;
+    }
+};
+
+
+#ifdef THORVG_WASM_EXPORT
+
+/* The state of an export in progress. It rasterizes a copy of the animation with a sw canvas of its own,
+   so that it doesn't disturb the playback, and reuses the canvas and the buffers over the frames. */
+struct TvgExporter
+{
+    LottieAnimation* animation = nullptr;
+    SwCanvas* canvas = nullptr;
+    vector<uint32_t> pixels;
+    TvgPngEncoder png;
+    float next = 0;         //the frame to export next
+    float end = 0;
+    float stride = 1;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    bool encode = false;    //png, the raw rgba pixels otherwise
+
+    ~TvgExporter()
+    {
+        delete(animation);
+        delete(canvas);
+    }
+};
+
+#endif
+
+
+/* loads the asset of src the callback resolves into the image or the text paint. The resolved assets are shared
+   with the other instances through the module-wide cache, the retained ones are added to assets */
+static bool resolveAsset(const AssetResolverCallback& callback, vector<TvgAsset*>& assets, Paint* p, const char* src, void* data)
+{
+    auto& userData = *static_cast<val*>(data);
+    auto res = callback(val(src), userData);
+    if (res.isUndefined() || res.isNull()) return false;
+    if (!isValidProperty(res, "name") || !isValidProperty(res, "buffer") || !isValidProperty(res, "mimetype")) return false;
+
+    auto name = res["name"].as<string>();
+    auto mimetype = res["mimetype"].as<string>();
+
+    auto asset = retainAsset(name, res["buffer"]);
+    if (!asset) return false;
+    assets.push_back(asset);
+
+    if (p->type() == Type::Picture) {
+        return static_cast<Picture*>(p)->load(asset->data.data(), asset->data.size(), mimetype.c_str(), nullptr, false) == Result::Success;
+    } else if (p->type() == Type::Text) {
+        if (!loadAssetFont(asset, mimetype.c_str())) return false;
+        return static_cast<Text*>(p)->font(name.c_str()) == Result::Success;
+    }
+
+    return false;
+}
+
+
+class TvgLottieAnimation;
+
+//the live animations by their handle(), for tick()
+static vector<TvgLottieAnimation*>& _animations()
+{
+    static vector<TvgLottieAnimation*> animations;
+    return animations;
+}
+
+
+class __attribute__((visibility("default"))) TvgLottieAnimation
+{
+public:
+    ~TvgLottieAnimation()
+    {
+        _animations()[id] = nullptr;
+
+        exportEnd();
+
+        delete(animation);
+        delete(canvas);
+        release();
+        delete(engine);
+    }
+
+    explicit TvgLottieAnimation(string engine = "sw", string selector = "")
+    {
+        errorMsg = NoError;
+
+        //reuse a released handle first
+        auto& animations = _animations();
+        id = std::find(animations.begin(), animations.end(), nullptr) - animations.begin();
+        if (id == animations.size()) animations.push_back(this);
+        else animations[id] = this;
+
+        canvas = engineInit(this->engine, engine, selector, errorMsg);
+        if (!canvas) return;
+
+        animation = LottieAnimation::gen();
+        if (!animation) errorMsg = "Invalid animation";
+    }
+
+    string error()
+    {
+        return errorMsg;
+    }
+
+    Float32Array size()
+    {
+        return Float32Array(val(typed_memory_view(2, psize)));
+    }
+
+    float duration()
+    {
+        if (!canvas || !animation) return 0;
+        return animation->duration();
+    }
+
+    float totalFrame()
+    {
+        if (!canvas || !animation) return 0;
+        return animation->totalFrame();
+    }
+
+    float curFrame()
+    {
+        if (!canvas || !animation) return 0;
+        return animation->curFrame();
+    }
+
+    // the markers of the animation as [{name, begin, end}], the frame ranges they cover
+    val markers()
+    {
+        auto result = val::array();
+        if (!canvas || !animation) return result;
+
+        collect();
+
+        for (uint32_t i = 0; i < marks.size(); ++i) {
+            auto mark = val::object();
+            mark.set("name", marks[i].name);
+            mark.set("begin", marks[i].begin);
+            mark.set("end", marks[i].end);
+            result.set(i, mark);
+        }
+        return result;
+    }
+
+    /* Plays the frames [begin, end] of the animation only, then frame(), curFrame(), totalFrame() and duration() are
+       relative to the segment. The cached frames and the learned holds are kept across the segments. */
+    bool segment(float begin, float end)
+    {
+        if (!canvas || !animation) return false;
+
+        if (animation->segment(begin, end) != Result::Success) {
+            errorMsg = "segment() fail";
+            return false;
+        }
+        return select();
+    }
+
+    // plays the frames of the marker only, or the whole animation if the marker is empty
+    bool marker(string name)
+    {
+        if (!canvas || !animation) return false;
+
+        auto result = name.empty() ? animation->segment(0, length) : animation->segment(name.c_str());
+        if (result != Result::Success) {
+            errorMsg = "marker() fail";
+            return false;
+        }
+        return select();
+    }
+
+    bool load(string data, string mimetype, uint32_t width, uint32_t height)
+    {
+        return open(std::move(data), mimetype, width, height);
+    }
+
+    /* Reserves a buffer of the given size for the next loadBuffer() and returns its address in the wasm memory.
+       JS writes the data there (i.e. HEAPU8.set()) instead of passing it to load() as a string. */
+    uintptr_t allocate(uint32_t size)
+    {
+        staged.resize(size);
+        return size > 0 ? reinterpret_cast<uintptr_t>(&staged[0]) : 0;
+    }
+
+    // loads the data written to the allocate()d buffer, the animation takes it over without copying
+    bool loadBuffer(string mimetype, uint32_t width, uint32_t height)
+    {
+        return open(std::move(staged), mimetype, width, height);
+    }
+
+    /* Incremental loading, i.e. while the data is being downloaded: beginLoad(), appendChunk() per each received chunk,
+       then endLoad(). The chunks are gathered in place, so the data is complete for parsing right when the last one arrives.
+       size: the expected total size if it's known (i.e. Content-Length), it's only a hint to pre-size the buffer. */
+    bool beginLoad(string mimetype, uint32_t size)
+    {
+        errorMsg = NoError;
+
+        if (!canvas) return false;
+
+        staged.clear();
+        staged.reserve(size);
+        stagedType = std::move(mimetype);
+
+        return true;
+    }
+
+    // extends the data by the chunk size and returns the address to write the chunk (i.e. HEAPU8.set()), 0 on failure
+    uintptr_t appendChunk(uint32_t size)
+    {
+        if (!canvas || size == 0) return 0;
+
+        auto offset = staged.size();
+        staged.resize(offset + size);
+        return reinterpret_cast<uintptr_t>(&staged[offset]);
+    }
+
+    bool endLoad(uint32_t width, uint32_t height)
+    {
+        return open(std::move(staged), stagedType, width, height);
+    }
+
+    // drops the chunks gathered since beginLoad(), i.e. the download is cancelled. The current animation stays as is.
+    void cancelLoad()
+    {
+        staged.clear();
+        if (staged.capacity() > scratch) string().swap(staged);
+    }
+
+    ArrayBuffer render()
+    {
+        errorMsg = NoError;
+
+        if (!canvas || !animation || !rasterize()) return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
 
         return engine->output(width, height);
     }
 
+    /* The hold (begin, end frames) the last rendered frame is in, within which the animation has no visual change.
+       The holds are learned from the whole frames while the animation is played with detectHolds() (sw engine only),
+       (frame, frame) if it's not in a known one. */
+    Float32Array hold()
+    {
+        range[0] = range[1] = shown;
+        for (auto& hold : holds) {
+            if (hold.first <= shown && shown <= hold.second) {
+                range[0] = hold.first;
+                range[1] = hold.second;
+                break;
+            }
+        }
+        //relative to the segment
+        range[0] -= origin;
+        range[1] -= origin;
+        return Float32Array(val(typed_memory_view(2, range)));
+    }
+
+    /* The region (x, y, w, h) updated by the last render(). It's the union of the painted bounds of
+       the previous and the current frame, the pixels outside of it are unchanged. It's the painted area, not the changed one,
+       so it pays off for the sparse animations: a layer covering the canvas, or effects drawing beyond the paint bounds,
+       make it the whole frame. Calling this turns on the tracking, so the first call reports the whole canvas. */
+    Int32Array damage()
+    {
+        if (!tracking) {
+            tracking = true;
+            dirty[0] = dirty[1] = 0;
+            dirty[2] = width;
+            dirty[3] = height;
+            redraw = true;
+        }
+        return Int32Array(val(typed_memory_view(4, dirty)));
+    }
+
+    // the rendered rows covered by damage(), to upload the changed area only
+    ArrayBuffer region()
+    {
+        if (!canvas || !animation) return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
+        return engine->output(width, dirty[1], dirty[3]);
+    }
+
+    /* Renders the frame like render() and uploads it into the texture of the caller (sw engine only):
+       a WebGLTexture with its WebGL2RenderingContext, or a GPUTexture (rgba8unorm, resolution() size, COPY_DST usage)
+       with its GPUDevice. The pixels go from the wasm memory to the texture with a single copy, and only the damage()d
+       region of the previous upload is sent again, so keep a texture per animation. See colorSpace() for a premultiplied one. */
+    bool renderToTexture(val context, val texture)
+    {
+        errorMsg = NoError;
+
+        if (!canvas || !animation) return false;
+
+        if (!engine->pixels() && width > 0) {
+            errorMsg = "renderToTexture() is for the sw engine, attach() the texture to the others";
+            return false;
+        }
+
+        //the first upload takes the whole frame
+        if (!tracking) damage();
+
+        if (!rasterize()) return false;
+        if (!engine->pixels()) return false;
+
+        //nothing new since the last upload
+        if (uploaded == gen && textured) return true;
+
+        auto full = !textured || uploaded + 1 != gen;
+        auto x = full ? 0 : dirty[0], y = full ? 0 : dirty[1];
+        auto w = full ? int32_t(width) : dirty[2], h = full ? int32_t(height) : dirty[3];
+        if (w > 0 && h > 0 && !uploadTexture(context.as_handle(), texture.as_handle(), engine->pixels(), width, x, y, w, h, full)) {
+            errorMsg = "The texture is smaller than resolution()";
+            return false;
+        }
+
+        uploaded = gen;
+        textured = true;
+        return true;
+    }
+
+    /* Renders into a caller-owned target instead of the canvas of the selector (gl/wg engines):
+       a WebGLFramebuffer of the same WebGL2 context ("gl"), or a GPUTexture of device() ("wg"),
+       of the resolution() size. undefined goes back to the canvas. */
+    bool attach(val target)
+    {
+        errorMsg = NoError;
+
+        if (!canvas) return false;
+
+        canvas->sync();
+
+        if (!engine->attach(target)) {
+            errorMsg = "attach() is for the gl/wg engines, use renderToTexture() with the sw engine";
+            return false;
+        }
+
+        //retargeted by the next update()
+        width = height = 0;
+        updated = true;
+        redraw = true;
+        sampled = false;
+        return true;
+    }
+
+    /* The address of the rendered pixels in the wasm memory (sw engine only, 0 otherwise).
+       It stays the same until the canvas grows, so JS can keep a single view on it instead of taking a new one from render() every frame. */
+    uintptr_t buffer()
+    {
+        if (!canvas) return 0;
+        return reinterpret_cast<uintptr_t>(engine->pixels());
+    }
+
+    // the byte length of the rendered pixels at buffer()
+    uint32_t bytes()
+    {
+        if (!canvas || !engine->pixels()) return 0;
+        return width * height * sizeof(uint32_t);
+    }
+
+    // the frame of the last render() as an ImageBitmap, its top-left resolution() area ("gl-shared" engine only)
+    val bitmap()
+    {
+        if (!canvas || !animation) return val::undefined();
+        return engine->bitmap(width, height);
+    }
+
+    // increased by every render() that produced a new frame
+    uint32_t generation()
+    {
+        return gen;
+    }
+
+    // identifies the animation in the tick() entries
+    uint32_t handle()
+    {
+        return id;
+    }
+
+    /* Reserves the entries of the next tick() and returns their address in the wasm memory.
+       An entry is two words, the handle() of an animation and the frame number (float) to render. */
+    static uintptr_t schedule(uint32_t count)
+    {
+        auto& entries = _entries();
+        entries.resize(count * 2);
+        return count > 0 ? reinterpret_cast<uintptr_t>(entries.data()) : 0;
+    }
+
+    /* Advances, updates and renders the first count animations of the schedule()d entries in a single call,
+       as frame(), update() and render() would do one by one. Returns the number of the rendered animations.
+       The frames are taken as they are by the caller, i.e. with buffer(), damage() and generation(). */
+    static uint32_t tick(uint32_t count)
+    {
+        auto& entries = _entries();
+        auto& animations = _animations();
+        count = std::min(count, uint32_t(entries.size() / 2));
+
+        uint32_t rendered = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            auto handle = entries[i * 2];
+            auto target = handle < animations.size() ? animations[handle] : nullptr;
+            if (!target || !target->canvas || !target->animation) continue;
+
+            float no;
+            memcpy(&no, &entries[i * 2 + 1], sizeof(float));
+
+            target->errorMsg = NoError;
+            if (!target->frame(no) || !target->update() || !target->rasterize()) continue;
+            ++rendered;
+        }
+        return rendered;
+    }
+
     bool update()
     {
+        if (canvas && animation) {
+            retarget();
+            collect();
+        }
+
         if (!updated) return true;
 
-        errorMsg = NoError;
+        errorMsg = NoError;
+
+        //render() will serve it from the cache, no need to update the scene
+        if (cache.budget > 0 && engine->pixels() && cache.find(at(), width, height, qvalue)) return true;
+
+        if (tuner.target > 0.0f) clock = emscripten_get_now();
+
+        auto begin = profile.begin();
+
+        if (canvas->update() != Result::Success) {
+            errorMsg = "update() fail";
+            return false;
+        }
+
+        profile.end(TvgStats::Update, begin);
+        profile.count(animation->picture());
+
+        return true;
+    }
+
+    bool frame(float no)
+    {
+        if (!canvas || !animation) return false;
+
+        //down to the frames of the capped rate, the requests in between leave the model as it is
+        if (rate > 0.0f && animation->duration() > 0.0f) {
+            auto step = std::max(1.0f, animation->totalFrame() / animation->duration() / rate);
+            no = floorf(no / step) * step;
+        }
+
+        //whole frames only, so that a loop maps to the same cached frames every time
+        if (cache.budget > 0) no = roundf(no);
+
+        auto begin = profile.begin();
+        if (animation->frame(no) == Result::Success) {
+            //within a hold, the scene would look just like the shown one
+            if (!held(at())) updated = true;
+        }
+        profile.end(TvgStats::Frame, begin);
+        return true;
+    }
+
+    bool viewport(float x, float y, float width, float height)
+    {
+        if (!canvas || !animation) return false;
+        if (vport[0] == x && vport[1] == y && vport[2] == width && vport[3] == height) return true;
+
+        if (canvas->viewport(x, y, width, height) != Result::Success) {
+            errorMsg = "viewport() fail";
+            return false;
+        }
+
+        vport[0] = x;
+        vport[1] = y;
+        vport[2] = width;
+        vport[3] = height;
+        redraw = true;
+        cache.clear();
+
+        return true;
+    }
+
+    void resize(uint32_t width, uint32_t height)
+    {
+        if (!canvas || !animation) return;
+
+        requested[0] = width;
+        requested[1] = height;
+
+        //the adaptive mode may render at a lower resolution, the output is upscaled to the display
+        auto ratio = tuner.scale();
+        if (ratio < 1.0f) {
+            width = std::max(uint32_t(width * ratio), 1u);
+            height = std::max(uint32_t(height * ratio), 1u);
+        }
+
+        if (this->width == width && this->height == height) return;
+
+        canvas->sync();
+
+        this->width = width;
+        this->height = height;
+        textured = false;
+
+        engine->resize(canvas, width, height);
+
+        auto scale = (psize[0] > psize[1]) ? width / psize[0] : height / psize[1];
+        animation->picture()->scale(scale);
+        animation->picture()->translate(width * 0.5f, height * 0.5f);
+
+
+        updated = true;
+        redraw = true;
+    }
+
+    /* Starts exporting the frames [begin, end) of the segment by the stride, at the given size and format
+       ("png" or "rgba", the raw pixels), end <= 0 for the end of the segment. The frames are rendered by
+       a sw canvas of the export, regardless of the engine, and taken one by one with exportNext(). */
+    bool exportBegin(float begin, float end, float stride, uint32_t width, uint32_t height, string format)
+    {
+        errorMsg = NoError;
+
+        exportEnd();
+
+        if (!canvas || !animation || source.empty()) {
+            errorMsg = "Invalid animation";
+            return false;
+        }
+
+#ifdef THORVG_WASM_EXPORT
+        if (format != "png" && format != "rgba") {
+            errorMsg = "Invalid format";
+            return false;
+        }
+
+        if (width == 0 || height == 0 || stride <= 0.0f) {
+            errorMsg = "Invalid size";
+            return false;
+        }
+
+        auto exporter = new TvgExporter;
+        exporter->canvas = SwCanvas::gen(EngineOption::None);
+        exporter->animation = LottieAnimation::gen();
+
+        auto picture = exporter->animation->picture();
+        picture->origin(0.5f, 0.5f);
+        picture->resolver(resolver.func, &resolver.data);
+
+        if (!exporter->canvas || picture->load(source.c_str(), source.size(), filetypeOf(sourceType)) != Result::Success) {
+            delete(exporter);
+            errorMsg = "load() fail";
+            return false;
+        }
+
+        exporter->animation->quality(preferred);
+
+        //fit and center it like resize() does
+        auto scale = (psize[0] > psize[1]) ? width / psize[0] : height / psize[1];
+        picture->scale(scale);
+        picture->translate(width * 0.5f, height * 0.5f);
+
+        exporter->pixels.resize(width * height);
+        exporter->canvas->target(exporter->pixels.data(), width, width, height, ColorSpace::ABGR8888S);
+
+        if (exporter->canvas->push(picture) != Result::Success) {
+            delete(exporter);
+            errorMsg = "push() fail";
+            return false;
+        }
+
+        auto total = totalFrame();
+        exporter->next = std::max(begin, 0.0f) + origin;
+        exporter->end = ((end <= 0.0f || end > total) ? total : end) + origin;
+        exporter->stride = stride;
+        exporter->width = width;
+        exporter->height = height;
+        exporter->encode = (format == "png");
+
+        exporting = exporter;
+        return true;
+#else
+        errorMsg = "Export is not supported";
+        return false;
+#endif
+    }
+
+    /* Renders and encodes the next frame of the export. The buffer stays valid until the next call,
+       it's empty once all the frames are exported or on failure. */
+    ArrayBuffer exportNext()
+    {
+        errorMsg = NoError;
+
+#ifdef THORVG_WASM_EXPORT
+        auto exporter = exporting;
+        if (!exporter || exporter->next >= exporter->end) return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
+
+        exporter->animation->frame(exporter->next);
+        exporter->next += exporter->stride;
+
+        if (exporter->canvas->update() != Result::Success || exporter->canvas->draw(true) != Result::Success) {
+            errorMsg = "draw() fail";
+            return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
+        }
+        exporter->canvas->sync();
+
+        auto pixels = reinterpret_cast<uint8_t*>(exporter->pixels.data());
+        if (!exporter->encode) return ArrayBuffer(val(typed_memory_view(exporter->pixels.size() * sizeof(uint32_t), pixels)));
+
+        exporter->png.encode(pixels, exporter->width, exporter->height);
+        return ArrayBuffer(val(typed_memory_view(exporter->png.out.size(), exporter->png.out.data())));
+#else
+        return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
+#endif
+    }
+
+    // ends the export and releases its canvas and buffers
+    void exportEnd()
+    {
+#ifdef THORVG_WASM_EXPORT
+        delete(exporting);
+        exporting = nullptr;
+#endif
+    }
+
+    // exports all the frames at once, an array of the copies of the exportNext() buffers
+    val exportFrames(float begin, float end, float stride, uint32_t width, uint32_t height, string format)
+    {
+        auto frames = val::array();
+        if (!exportBegin(begin, end, stride, width, height, format)) return frames;
+
+        while (true) {
+            auto frame = exportNext();
+            if (frame["byteLength"].as<uint32_t>() == 0) break;
+            frames.call<void>("push", frame.call<val>("slice"));
+        }
+        exportEnd();
+
+        return frames;
+    }
+
+    bool save(string data, string mimetype)
+    {
+        if (mimetype == "gif") return save2Gif(data);
+        errorMsg = "Invalid mimetype";
+        return false;
+    }
+
+    bool save2Gif(string data)
+    {
+#ifdef THORVG_GIF_SAVER_SUPPORT
+        errorMsg = NoError;
+
+        if (data.empty()) {
+            errorMsg = "Invalid data";
+            return false;
+        }
+
+        auto saver = unique_ptr<Saver>(Saver::gen());
+        if (!saver) {
+            errorMsg = "Invalid saver";
+            return false;
+        }
+
+        //animation to save
+        auto animation = unique_ptr<Animation>(Animation::gen());
+        if (!animation) {
+            errorMsg = "Invalid animation";
+            return false;
+        }
+
+        prepareFont(data);
+
+        if (animation->picture()->load(data.c_str(), data.size(), "lot", nullptr, false) != Result::Success) {
+            errorMsg = "load() fail";
+            return false;
+        }
+
+        //gif resolution (600x600)
+        constexpr float GIF_SIZE = 600;
+
+        //transform
+        float width, height;
+        animation->picture()->size(&width, &height);
+        float scale;
+        if (width > height) scale = GIF_SIZE / width;
+        else scale = GIF_SIZE / height;
+        animation->picture()->size(width * scale, height * scale);
+
+        //set a white opaque background
+        auto bg = tvg::Shape::gen();
+        if (!bg) {
+            errorMsg = "Invalid bg";
+            return false;
+        }
+        bg->fill(255, 255, 255, 255);
+        bg->appendRect(0, 0, GIF_SIZE, GIF_SIZE);
+
+        if (saver->background(bg) != Result::Success) {
+            errorMsg = "background() fail";
+            return false;
+        }
+
+        if (saver->save(animation.release(), "output.gif", 100, 30) != tvg::Result::Success) {
+            errorMsg = "save(), fail";
+            return false;
+        }
+
+        saver->sync();
+
+        return true;
+#else
+        errorMsg = "GIF saver is not supported";
+        return false;
+#endif
+    }
+
+    bool quality(uint8_t value)
+    {
+        errorMsg = NoError;
+
+        if (!canvas || !animation) return false;
+
+        auto applied = tuner.quality(value);
+        if (animation->quality(applied) != Result::Success) {
+            errorMsg = "quality() fail";
+            return false;
+        }
+
+        preferred = value;
+        qvalue = applied;
+        updated = true;
+        return true;
+    }
+
+    /* Keeps the frame time (update() and render() in milliseconds) within the target by lowering the quality
+       and then the render resolution under pressure, and raising them again with headroom. 0 turns it off. */
+    bool adaptive(float frameTime)
+    {
+        if (!canvas || !animation) return false;
+
+        tuner.reset();
+        tuner.target = frameTime;
+        adapt();
+
+        //back to the full resolution
+        resize(requested[0], requested[1]);
+
+        return true;
+    }
+
+    /* Caps the model evaluation at fps (at most the frame rate of the animation itself): frame() snaps the frame numbers
+       to the frames of the rate, so on a display refreshing faster than that, the frames in between don't update the scene
+       and render() has nothing new to draw or upload. 0 (default) evaluates every frame number as it's given, with sub-frame tweens.
+       It's a frame rate cap only: each frame it does evaluate rebuilds the whole scene as usual, there's no cheaper path
+       for the frames changing transforms only, since the lottie loader doesn't tell which properties changed. */
+    void frameRate(float fps)
+    {
+        rate = std::max(fps, 0.0f);
+    }
+
+    /* Learns the holds of the animation while it's played (sw engine only): each rendered frame is hashed and compared
+       with the previous one, so that update() and render() skip the whole frames of a known hold and hold() reports it.
+       It costs a pass over the pixels per rendered frame, off by default. */
+    void detectHolds(bool on)
+    {
+        detecting = on;
+        holds.clear();
+        sampled = false;
+    }
+
+    // the size (width, height) rendered at, it's smaller than the requested one while the adaptive mode scales down
+    Uint32Array resolution()
+    {
+        extent[0] = width;
+        extent[1] = height;
+        return Uint32Array(val(typed_memory_view(2, extent)));
+    }
+
+    /* Keeps the rendered frames within the budget (in bytes) and serves them again instead of redrawing,
+       once a loop has played through. If the loop doesn't fit in, the frames cached so far are kept and served,
+       the rest of the loop is drawn as usual. The frame numbers are rounded to the whole frames meanwhile,
+       the sub-frame tweens aren't shown. 0 disables the cache. It's for the sw engine, the others ignore it. */
+    bool cacheBudget(uint32_t bytes, bool compress)
+    {
+        if (!canvas || !animation) return false;
+
+        if (compress != cache.compress || bytes == 0) cache.clear();
+
+        cache.budget = bytes;
+        cache.compress = compress;
+        cache.full = false;
+        cache.reserve(0);
+        vector<uint32_t>().swap(cache.spare);
+
+        return true;
+    }
+
+    // turns on/off the frame timings and counters of stats(), they start over when it's turned on
+    void enableStats(bool on)
+    {
+        if (on && !profile.enabled) profile.reset();
+        profile.enabled = on;
+    }
+
+    /* {frame, update, draw, sync, upload: {min, avg, p95, max}, frames, paints, bytes, reallocs}
+       The phase timings are in milliseconds over the recent 120 frames. */
+    val stats()
+    {
+        return profile.report(engine ? engine->reallocs : 0);
+    }
+
+    // the time (ms) the caller took to upload the rendered frame, i.e. putImageData()
+    void recordUpload(double ms)
+    {
+        profile.record(TvgStats::Upload, ms);
+    }
+
+    /* The bytes held by the animation: {heap, source, raster, cache, images, fonts, pool}.
+       source is the kept source data (the parsed model isn't measurable), raster the target buffers, cache the cached frames,
+       images and fonts the resolved assets in use (fonts with the default one if it's registered), pool the idle buffers
+       of the module and heap the whole wasm memory, which never shrinks. */
+    val memoryUsage()
+    {
+        double images = 0, fonts = 0;
+        for (auto asset : assets) (asset->font ? fonts : images) += asset->data.size();
+        if (_engineContext().font) fonts += DEFAULT_FONT_SIZE;
+
+        double raster = engine ? engine->footprint() : 0;
+#ifdef THORVG_WASM_EXPORT
+        if (exporting) raster += exporting->pixels.capacity() * sizeof(uint32_t) + exporting->png.out.capacity();
+#endif
+
+        auto result = val::object();
+        result.set("heap", double(emscripten_get_heap_size()));
+        result.set("source", double(source.capacity() + staged.capacity()));
+        result.set("raster", raster);
+        result.set("cache", double(cache.used));
+        result.set("images", images);
+        result.set("fonts", fonts);
+        result.set("pool", double(pooledBytes()));
+        return result;
+    }
+
+    /* Releases what can be made again: the cached frames, the staged data, an export in progress and the target buffer,
+       i.e. when the player goes off-screen. The next update() takes the target buffer again and redraws.
+       The freed memory goes back to the allocator for the other allocations, the wasm heap itself doesn't shrink. */
+    void trim()
+    {
+        if (!canvas) return;
+
+        canvas->sync();
+
+        cache.clear();
+        string().swap(staged);
+        exportEnd();
+
+        engine->trim();
+        width = height = 0;
+        updated = true;
+        redraw = true;
+        sampled = false;
+    }
+
+    /* Caps the scratch memory kept for the reuse (in bytes): the data buffer of the previous load() kept for the next one,
+       and the target buffer beyond the size in use after shrinking. Unlimited by default. */
+    void scratchLimit(uint32_t bytes)
+    {
+        scratch = bytes;
+        if (engine) engine->scratch = bytes;
+        if (staged.empty() && staged.capacity() > scratch) string().swap(staged);
+    }
+
+    /* The pixel format of the rendered frames for the sw engine: "abgr8888s" (default, straight RGBA as ImageData takes it),
+       "argb8888s", or the premultiplied "abgr8888" and "argb8888", i.e. for a WebGL texture with premultiplied alpha.
+       The rasterizer writes them in the format directly, no conversion pass runs afterwards. */
+    bool colorSpace(string name)
+    {
+        errorMsg = NoError;
+
+        if (!canvas) return false;
+
+        auto value = colorSpaceOf(name);
+        if (value == ColorSpace::Unknown) {
+            errorMsg = "Unknown color space";
+            return false;
+        }
+        if (value == engine->cs) return true;
+
+        canvas->sync();
+
+        if (!engine->colorSpace(value)) {
+            errorMsg = "colorSpace() is for the sw engine";
+            return false;
+        }
+
+        //the cached frames are in the previous format, the target is taken again by the next update()
+        cache.clear();
+        width = height = 0;
+        updated = true;
+        redraw = true;
+        sampled = false;
+        return true;
+    }
+
+    // budget, used bytes, cached frames, hits, misses
+    Uint32Array cacheStats()
+    {
+        cacheInfo[0] = cache.budget;
+        cacheInfo[1] = cache.used;
+        cacheInfo[2] = cache.frames.size();
+        cacheInfo[3] = cache.hits;
+        cacheInfo[4] = cache.misses;
+        return Uint32Array(val(typed_memory_view(5, cacheInfo)));
+    }
+
+    bool setAssetResolver(AssetResolverCallback callback, val data)
+    {
+        errorMsg = NoError;
+
+        if (!canvas || !animation) return false;
+
+        if (callback.isUndefined() || callback.isNull()) {
+            animation->picture()->resolver(nullptr, nullptr);
+            return true;
+        }
+
+        auto func = [this, callback](Paint* p, const char* src, void* data) -> bool {
+            return resolveAsset(callback, assets, p, src, data);
+        };
+
+        resolver = {func, data};
+
+        return true;
+    }
+
+private:
+    static vector<uint32_t>& _entries()
+    {
+        static vector<uint32_t> entries;
+        return entries;
+    }
+
+    //the target was trimmed, take it again before anything reaches the canvas. false if there's nothing to draw into
+    bool retarget()
+    {
+        if (width == 0 && requested[0] > 0 && requested[1] > 0) resize(requested[0], requested[1]);
+        return width > 0 && height > 0;
+    }
+
+    // draws the updated scene into the target, false if it fails
+    bool rasterize()
+    {
+        //i.e. trimmed, the sw target buffer is gone until it's taken again
+        if (!retarget()) {
+            errorMsg = "draw() fail";
+            return false;
+        }
+
+        if (!updated) {
+            dirty[2] = dirty[3] = 0;
+            return true;
+        }
+
+        auto pixels = cache.budget > 0 ? engine->pixels() : nullptr;
+
+        if (pixels && cache.fetch(pixels, at(), width, height, qvalue)) {
+            //the scene wasn't drawn, so the painted area is unknown
+            if (tracking) {
+                redraw = true;
+                track(width, height);
+            }
+            updated = false;
+            sampled = false;
+            ++gen;
+            return true;
+        }
+
+        auto begin = profile.begin();
+
+        if (canvas->draw(true) != Result::Success) {
+            errorMsg = "draw() fail";
+            return false;
+        }
+
+        profile.end(TvgStats::Draw, begin);
+        begin = profile.begin();
+
+        canvas->sync();
+
+        profile.end(TvgStats::Sync, begin);
+        ++profile.frames;
+        profile.bytes += width * height * sizeof(uint32_t);
+
+        if (tuner.target > 0.0f && tuner.measure(emscripten_get_now() - clock)) adapt();
+
+        auto forced = redraw;
+        if (tracking) track(width, height);
+        redraw = false;
+
+        if (pixels) cache.store(pixels, at(), width, height, qvalue);
+
+        updated = false;
+
+        //no visual change, nothing to upload
+        if (!observe(forced)) {
+            dirty[2] = dirty[3] = 0;
+            return true;
+        }
+
+        ++gen;
+
+        return true;
+    }
+
+    // applies the quality of the adaptive level, the resolution follows with the next resize()
+    void adapt()
+    {
+        auto value = tuner.quality(preferred);
+        if (value == qvalue) return;
+        if (animation->quality(value) == Result::Success) {
+            qvalue = value;
+            updated = true;
+        }
+    }
+
+    bool open(string&& data, const string& mimetype, uint32_t width, uint32_t height)
+    {
+        errorMsg = NoError;
+
+        if (!canvas) return false;
+
+        if (data.empty()) {
+            errorMsg = "Invalid data";
+            return false;
+        }
+
+        //the export in progress reads the source data in place, it goes away below
+        exportEnd();
+
+        canvas->remove();
+
+        delete(animation);
+        release();
+        animation = LottieAnimation::gen();
+
+        //keep the buffer of the previous data to load the next one into, within the scratch limit
+        std::swap(source, data);
+        auto previous = std::move(data);    //data may be the staged one itself
+        previous.clear();
+        if (previous.capacity() <= scratch && previous.capacity() > staged.capacity()) staged = std::move(previous);
+
+        animation->picture()->origin(0.5f, 0.5f);  //center-aligned
+
+        animation->picture()->resolver(resolver.func, &resolver.data);
+
+        //the loader may parse it asynchronously, keep the source data alive along with the animation
+        sourceType = mimetype;
+        prepareFont(source);
+
+        if (animation->picture()->load(source.c_str(), source.size(), filetypeOf(mimetype)) != Result::Success) {
+            errorMsg = "load() fail";
+            return false;
+        }
+
+        //a new animation starts over at the full quality and resolution
+        tuner.reset();
+        animation->quality(preferred);
+        qvalue = preferred;
+
+        length = animation->totalFrame();
+        origin = 0;
+        marks.clear();
+        marked = false;
+        effects = hasEffects(source);
+        covered = 0;
+
+        animation->picture()->size(&psize[0], &psize[1]);
+
+        /* need to reset size to calculate scale in Picture.size internally before calling resize() */
+        this->width = 0;
+        this->height = 0;
+
+        resize(width, height);
+
+        if (canvas->push(animation->picture()) != Result::Success) {
+            errorMsg = "push() fail";
+            return false;
+        }
+
+        updated = true;
+        redraw = true;
+        cache.clear();
+        holds.clear();
+        sampled = false;
+
+        return true;
+    }
+
+    /* Compares the rendered frame with the previous one to learn the holds of the animation.
+       Returns false if the frame looks just the same as the previous one. */
+    bool observe(bool forced)
+    {
+        auto pixels = engine->pixels();
+        if (!detecting || !pixels) return true;
+
+        auto no = at();
+
+        //64-bit FNV-1a over the pixel pairs
+        auto words = reinterpret_cast<const uint64_t*>(pixels);
+        auto cnt = width * height / 2;
+        uint64_t hash = 14695981039346656037ULL;
+        for (uint32_t i = 0; i < cnt; ++i) hash = (hash ^ words[i]) * 1099511628211ULL;
+        if ((width * height) % 2) hash = (hash ^ reinterpret_cast<const uint32_t*>(pixels)[width * height - 1]) * 1099511628211ULL;
+
+        auto same = sampled && !forced && hash == signature;
+
+        /* learn from the adjacent whole frames only, a change in between the distant ones could be missed.
+           The sub-frames aren't proven static by them, the easing may move things in between */
+        if (same && whole(no) && whole(shown) && fabsf(no - shown) <= 1.0f) {
+            auto hold = make_pair(std::min(no, shown), std::max(no, shown));
+            for (auto it = holds.begin(); it != holds.end(); ) {
+                if (it->second < hold.first || hold.second < it->first) {
+                    ++it;
+                    continue;
+                }
+                hold.first = std::min(hold.first, it->first);
+                hold.second = std::max(hold.second, it->second);
+                it = holds.erase(it);
+            }
+            holds.push_back(hold);
+        }
+
+        signature = hash;
+        sampled = true;
+        shown = no;
 
-        if (canvas->update() != Result::Success) {
-            errorMsg = "update() fail";
-            return false;
+        return !same;
+    }
+
+    /* Reads the marker ranges once per load, before the first update() or with the first markers().
+       There is no direct query of them: each is selected once, then the segment and the frame are restored,
+       ahead of any cached frame or learned hold. It's after the parsing, which the mt loader may still be at in open(). */
+    void collect()
+    {
+        if (marked) return;
+        marked = true;
+
+        auto cnt = animation->markersCnt();
+        if (cnt == 0) return;
+
+        float begin, end;
+        animation->segment(&begin, &end);
+        auto no = animation->curFrame();
+        for (uint32_t i = 0; i < cnt; ++i) {
+            auto name = animation->marker(i);
+            float from, to;
+            if (!name || animation->segment(name) != Result::Success || animation->segment(&from, &to) != Result::Success) continue;
+            marks.push_back({name, from, to});
         }
+        animation->segment(begin, end);
+        animation->frame(no);
+    }
 
-        return true;
+    // the current frame number from the beginning of the animation, regardless of the segment
+    float at()
+    {
+        return animation->curFrame() + origin;
     }
 
-    bool frame(float no)
+    // applies the newly selected segment
+    bool select()
     {
-        if (!canvas || !animation) return false;
-        if (animation->frame(no) == Result::Success) {
-            updated = true;
-        }
+        float end;
+        animation->segment(&origin, &end);
+        //the frames of the new segment may fit in
+        cache.full = false;
+        updated = true;
         return true;
     }
 
-    bool viewport(float x, float y, float width, float height)
+    static bool whole(float no)
     {
-        if (!canvas || !animation) return false;
-        if (canvas->viewport(x, y, width, height) != Result::Success) {
-            errorMsg = "viewport() fail";
-            return false;
+        return no == floorf(no);
+    }
+
+    // whether the frame no is a whole frame in the hold of the shown one, each of which was observed the same
+    bool held(float no)
+    {
+        if (!sampled || !whole(no) || !whole(shown)) return false;
+        auto a = std::min(shown, no);
+        auto b = std::max(shown, no);
+        for (auto& hold : holds) {
+            if (hold.first <= a && b <= hold.second) return true;
         }
+        return false;
+    }
 
-        return true;
+    // drops the assets used by the previous animation
+    void release()
+    {
+        for (auto asset : assets) releaseAsset(asset);
+        assets.clear();
     }
 
-    void resize(uint32_t width, uint32_t height)
+    void track(uint32_t w, uint32_t h)
     {
-        if (!canvas || !animation) return;
-        if (this->width == width && this->height == height) return;
+        //the paints are walked again after this many frames of painting the whole canvas
+        constexpr uint32_t RECHECK = 30;
+
+        /* The effects draw beyond the paint bounds, and a frame painting the whole canvas (i.e. a background layer)
+           is likely followed by more of them: the whole frame, without walking the paints for nothing. */
+        if (effects || (covered > 0 && !redraw)) {
+            if (covered > 0) --covered;
+            dirty[0] = dirty[1] = 0;
+            dirty[2] = w;
+            dirty[3] = h;
+            redraw = false;
+            return;
+        }
 
-        canvas->sync();
+        //min x, min y, max x, max y of the painted area
+        float bbox[4] = {FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX};
+
+        auto picture = animation->picture();
+        auto accessor = unique_ptr<Accessor>(Accessor::gen());
+        accessor->set(picture, [picture](const Paint* paint, void* data) -> bool {
+            if (paint == picture) return true;
+            float x, y, w, h;
+            if (paint->bounds(&x, &y, &w, &h) != Result::Success || w <= 0.0f || h <= 0.0f) return true;
+            auto bbox = static_cast<float*>(data);
+            bbox[0] = std::min(bbox[0], x);
+            bbox[1] = std::min(bbox[1], y);
+            bbox[2] = std::max(bbox[2], x + w);
+            bbox[3] = std::max(bbox[3], y + h);
+            return true;
+        }, bbox);
+
+        if (bbox[0] <= 0.0f && bbox[1] <= 0.0f && bbox[2] >= float(w) && bbox[3] >= float(h)) covered = RECHECK;
+
+        if (redraw) {
+            dirty[0] = dirty[1] = 0;
+            dirty[2] = w;
+            dirty[3] = h;
+            redraw = false;
+        } else {
+            float area[4] = {std::min(prev[0], bbox[0]), std::min(prev[1], bbox[1]), std::max(prev[2], bbox[2]), std::max(prev[3], bbox[3])};
+            dirty[2] = dirty[3] = 0;
+            if (area[0] < area[2] && area[1] < area[3]) {
+                //1px margin for the anti-aliased edges
+                auto x1 = std::max(int32_t(floorf(std::max(area[0], -1.0f))) - 1, 0);
+                auto y1 = std::max(int32_t(floorf(std::max(area[1], -1.0f))) - 1, 0);
+                auto x2 = std::min(int32_t(ceilf(std::min(area[2], float(w)))) + 1, int32_t(w));
+                auto y2 = std::min(int32_t(ceilf(std::min(area[3], float(h)))) + 1, int32_t(h));
+                if (x1 < x2 && y1 < y2) {
+                    dirty[0] = x1;
+                    dirty[1] = y1;
+                    dirty[2] = x2 - x1;
+                    dirty[3] = y2 - y1;
+                }
+            }
+        }
 
-        this->width = width;
-        this->height = height;
+        for (int i = 0; i < 4; ++i) prev[i] = bbox[i];
+    }
 
-        engine->resize(canvas, width, height);
+    string                 errorMsg;
+    string                 source;           //animation data
+    string                 sourceType;       //mimetype of the source
+    string                 staged;           //allocate()d or the incrementally loaded data
+    string                 stagedType;       //mimetype of the incrementally loaded data
+    vector<TvgAsset*>      assets;           //resolved assets in use
+    Canvas*                canvas = nullptr;
+    LottieAnimation*       animation = nullptr;
+    TvgEngine*             engine = nullptr;
+    uint32_t               width = 0;
+    uint32_t               height = 0;
+    float                  psize[2];         //picture size
+    float                  vport[4] = {0, 0, 0, 0};
+    float                  prev[4] = {FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX};   //painted area of the previous frame
+    int32_t                dirty[4] = {0, 0, 0, 0};
+    TvgFrameCache          cache;
+    TvgStats               profile;          //frame timings, see stats()
+    uint32_t               cacheInfo[5];
+    uint8_t                qvalue = 50;      //quality in use
+    uint8_t                preferred = 50;   //quality set by quality(), the adaptive mode may use a lower one
+    TvgAdaptive            tuner;            //the adaptive mode
+    double                 clock = 0;        //the time update() began, for the adaptive mode
+    float                  rate = 0;         //the capped frame rate, see frameRate()
+    uint32_t               requested[2] = {0, 0};   //the size given to resize()
+    size_t                 scratch = SIZE_MAX;      //see scratchLimit()
+    uint32_t               extent[2];
+    uint32_t               gen = 0;          //frame generation
+    uint32_t               uploaded = 0;     //the generation uploaded by renderToTexture()
+    bool                   textured = false; //the texture of renderToTexture() has a whole frame
+    uint32_t               id;               //handle in the animations
+    vector<pair<float, float>> holds;        //frame ranges without visual change
+    uint64_t               signature = 0;    //hash of the shown frame pixels
+    float                  shown = 0;        //frame number of the shown pixels (from the beginning of the animation)
+    float                  origin = 0;       //the first frame of the segment
+    float                  length = 0;       //the total frames of the whole animation
+    struct Marker { string name; float begin, end; };
+    vector<Marker>         marks;            //the markers and their ranges
+    bool                   marked = false;   //marks are collected
+    float                  range[2];
+    bool                   sampled = false;  //signature and shown are valid
+    bool                   detecting = false; //hold detection on, see detectHolds()
+    bool                   tracking = false;
+    bool                   effects = false;  //the layers draw beyond their bounds, the damage is the whole frame
+    uint32_t               covered = 0;      //frames left to report the whole frame without walking the paints
+    bool                   redraw = true;
+    bool                   updated = false;
+#ifdef THORVG_WASM_EXPORT
+    TvgExporter*           exporting = nullptr;
+#endif
+    struct {
+        std::function<bool(Paint* paint, const char* src, void* data)> func;
+        val data; //user data for JS data type
+    } resolver;
+};
 
-        auto scale = (psize[0] > psize[1]) ? width / psize[0] : height / psize[1];
-        animation->picture()->scale(scale);
-        animation->picture()->translate(width * 0.5f, height * 0.5f);
 
+#ifndef THORVG_WASM_SPECIALIZED
 
-        updated = true;
+/* Renders a number of lottie animations into the slots of a single shared canvas (atlas),
+   so that all of them are advanced and rasterized with a single engine, update(), draw() and sync().
+   Each slot is clipped to its region, the caller shows the regions of the output where it likes. */
+class __attribute__((visibility("default"))) TvgLottieBatch
+{
+public:
+    ~TvgLottieBatch()
+    {
+        for (auto& slot : slots) clear(slot);
+        delete(canvas);
+        delete(engine);
     }
 
-    bool save(string data, string mimetype)
+    explicit TvgLottieBatch(string engine = "sw", string selector = "")
     {
-        if (mimetype == "gif") return save2Gif(data);
-        errorMsg = "Invalid mimetype";
-        return false;
+        errorMsg = NoError;
+
+        canvas = engineInit(this->engine, engine, selector, errorMsg);
     }
 
-    bool save2Gif(string data)
+    string error()
+    {
+        return errorMsg;
+    }
+
+    // returns the slot id of the loaded animation, -1 on failure
+    int32_t add(string data, string mimetype, float x, float y, float w, float h)
     {
-#ifdef THORVG_GIF_SAVER_SUPPORT
         errorMsg = NoError;
 
+        if (!canvas) return -1;
+
         if (data.empty()) {
             errorMsg = "Invalid data";
-            return false;
+            return -1;
         }
 
-        auto saver = unique_ptr<Saver>(Saver::gen());
-        if (!saver) {
-            errorMsg = "Invalid saver";
-            return false;
-        }
+        //reuse a released slot first, the resolver finds the assets of the slot by the id
+        uint32_t id = std::find_if(slots.begin(), slots.end(), [](const Slot& slot) { return !slot.animation; }) - slots.begin();
+        if (id == slots.size()) slots.emplace_back();
+        auto& slot = slots[id];
 
-        //animation to save
-        auto animation = unique_ptr<Animation>(Animation::gen());
-        if (!animation) {
+        slot.animation = LottieAnimation::gen();
+        if (!slot.animation) {
             errorMsg = "Invalid animation";
-            return false;
+            return -1;
         }
 
-        if (animation->picture()->load(data.c_str(), data.size(), "lot", nullptr, false) != Result::Success) {
+        auto picture = slot.animation->picture();
+        picture->origin(0.5f, 0.5f);  //center-aligned
+
+        if (!resolver.func.isUndefined()) {
+            picture->resolver([this, id](Paint* p, const char* src, void* data) -> bool {
+                return resolveAsset(resolver.func, slots[id].assets, p, src, data);
+            }, &resolver.data);
+        }
+
+        //the loader may parse it asynchronously, keep the source data alive along with the animation
+        slot.source = std::move(data);
+        prepareFont(slot.source);
+
+        if (picture->load(slot.source.c_str(), slot.source.size(), filetypeOf(mimetype)) != Result::Success) {
+            clear(slot);
             errorMsg = "load() fail";
-            return false;
+            return -1;
         }
 
-        //gif resolution (600x600)
-        constexpr float GIF_SIZE = 600;
+        picture->size(&slot.psize[0], &slot.psize[1]);
 
-        //transform
-        float width, height;
-        animation->picture()->size(&width, &height);
-        float scale;
-        if (width > height) scale = GIF_SIZE / width;
-        else scale = GIF_SIZE / height;
-        animation->picture()->size(width * scale, height * scale);
+        //the scene holds the slot clip in the canvas space, apart from the transform of the picture
+        slot.scene = Scene::gen();
+        slot.scene->ref();
+        slot.scene->push(picture);
+        arrange(slot, x, y, w, h);
 
-        //set a white opaque background
-        auto bg = tvg::Shape::gen();
-        if (!bg) {
-            errorMsg = "Invalid bg";
-            return false;
+        if (canvas->push(slot.scene) != Result::Success) {
+            clear(slot);
+            errorMsg = "push() fail";
+            return -1;
         }
-        bg->fill(255, 255, 255, 255);
-        bg->appendRect(0, 0, GIF_SIZE, GIF_SIZE);
 
-        if (saver->background(bg) != Result::Success) {
-            errorMsg = "background() fail";
-            return false;
-        }
+        updated = true;
+        return id;
+    }
 
-        if (saver->save(animation.release(), "output.gif", 100, 30) != tvg::Result::Success) {
-            errorMsg = "save(), fail";
-            return false;
-        }
+    bool remove(uint32_t id)
+    {
+        auto slot = get(id);
+        if (!slot) return false;
 
-        saver->sync();
+        canvas->sync();
+        canvas->remove(slot->scene);
+        clear(*slot);
 
+        updated = true;
         return true;
-#else
-        errorMsg = "GIF saver is not supported";
-        return false;
-#endif
     }
 
-    bool quality(uint8_t value)
+    /* The assets (images, fonts) of the animations added after this call are resolved by the callback,
+       as TvgLottieAnimation::setAssetResolver() does. undefined goes back to the embedded ones */
+    bool setAssetResolver(AssetResolverCallback callback, val data)
     {
         errorMsg = NoError;
 
-        if (!canvas || !animation) return false;
+        if (!canvas) return false;
 
-        if (animation->quality(value) != Result::Success) {
-            errorMsg = "quality() fail";
-            return false;
-        }
+        if (callback.isUndefined() || callback.isNull()) resolver = {};
+        else resolver = {callback, data};
+
+        return true;
+    }
+
+    bool place(uint32_t id, float x, float y, float w, float h)
+    {
+        auto slot = get(id);
+        if (!slot) return false;
 
+        arrange(*slot, x, y, w, h);
         updated = true;
         return true;
     }
 
-    bool setAssetResolver(AssetResolverCallback callback, val data)
+    float duration(uint32_t id)
     {
-        errorMsg = NoError;
+        auto slot = get(id);
+        if (!slot) return 0;
+        return slot->animation->duration();
+    }
 
-        if (!canvas || !animation) return false;
+    float totalFrame(uint32_t id)
+    {
+        auto slot = get(id);
+        if (!slot) return 0;
+        return slot->animation->totalFrame();
+    }
 
-        if (callback.isUndefined() || callback.isNull()) {
-            animation->picture()->resolver(nullptr, nullptr);
-            return true;
+    bool frame(uint32_t id, float no)
+    {
+        auto slot = get(id);
+        if (!slot) return false;
+        if (slot->animation->frame(no) == Result::Success) updated = true;
+        return true;
+    }
+
+    // advance every slot at once. frame numbers are given in the slot id order, negative values are skipped.
+    bool frames(Float32Array nos)
+    {
+        if (!canvas) return false;
+
+        auto list = convertJSArrayToNumberVector<float>(nos);
+        auto cnt = std::min(list.size(), slots.size());
+
+        for (size_t i = 0; i < cnt; ++i) {
+            if (!slots[i].animation || list[i] < 0.0f) continue;
+            if (slots[i].animation->frame(list[i]) == Result::Success) updated = true;
         }
+        return true;
+    }
+
+    void resize(uint32_t width, uint32_t height)
+    {
+        if (!canvas) return;
+        if (this->width == width && this->height == height) return;
 
-        auto func = [callback](Paint* p, const char* src, void* data) -> bool {
-            auto& userData = *static_cast<val*>(data);
-            auto res = callback(val(src), userData);
-            if (res.isUndefined() || res.isNull()) return false;
-            if (!isValidProperty(res, "name") || !isValidProperty(res, "buffer") || !isValidProperty(res, "mimetype")) return false;
+        canvas->sync();
 
-            auto name = res["name"].as<string>();
-            auto buffer = vecFromJSArray<char>(res["buffer"]);
-            auto mimetype = res["mimetype"].as<string>();
+        this->width = width;
+        this->height = height;
 
-            if (p->type() == Type::Picture) {
-                return static_cast<Picture*>(p)->load(buffer.data(), buffer.size(), mimetype.c_str(), nullptr, false) == Result::Success;
-            } else if (p->type() == Type::Text) {
-                if (Text::load(name.c_str(), buffer.data(), buffer.size(), mimetype.c_str(), false) != Result::Success) return false;
-                return static_cast<Text*>(p)->font(name.c_str()) == Result::Success;
-            }
+        engine->resize(canvas, width, height);
 
-            return false;
-        };
+        updated = true;
+    }
 
-        resolver = {func, data};
+    bool update()
+    {
+        if (!updated) return true;
+
+        errorMsg = NoError;
+
+        if (!canvas || canvas->update() != Result::Success) {
+            errorMsg = "update() fail";
+            return false;
+        }
 
         return true;
     }
 
+    ArrayBuffer render()
+    {
+        errorMsg = NoError;
+
+        if (!canvas) return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
+
+        if (!updated) return engine->output(width, height);
+
+        if (canvas->draw(true) != Result::Success) {
+            errorMsg = "draw() fail";
+            return ArrayBuffer(val(typed_memory_view<uint8_t>(0, nullptr)));
+        }
+
+        canvas->sync();
+
+        updated = false;
+
+        return engine->output(width, height);
+    }
+
 private:
+    struct Slot
+    {
+        LottieAnimation* animation = nullptr;
+        Scene* scene = nullptr;         //the clipped holder of the picture on the canvas, referenced by the slot
+        string source;                  //animation data
+        float psize[2];                 //picture size
+        vector<TvgAsset*> assets;       //resolved assets in use
+    };
+
+    //drops the scene reference, the animation and the assets of the slot, for reuse
+    void clear(Slot& slot)
+    {
+        if (slot.scene) slot.scene->unref();
+        delete(slot.animation);
+        for (auto asset : slot.assets) releaseAsset(asset);
+        slot = Slot();
+    }
+
+    Slot* get(uint32_t id)
+    {
+        if (!canvas || id >= slots.size() || !slots[id].animation) return nullptr;
+        return &slots[id];
+    }
+
+    void arrange(Slot& slot, float x, float y, float w, float h)
+    {
+        auto picture = slot.animation->picture();
+        auto scale = (slot.psize[0] > slot.psize[1]) ? w / slot.psize[0] : h / slot.psize[1];
+        picture->scale(scale);
+        picture->translate(x + w * 0.5f, y + h * 0.5f);
+
+        auto clipper = Shape::gen();
+        clipper->appendRect(x, y, w, h);
+        slot.scene->clip(clipper);
+    }
+
     string                 errorMsg;
     Canvas*                canvas = nullptr;
-    LottieAnimation*       animation = nullptr;
-    TvgEngineMethod*       engine = nullptr;
+    TvgEngine*             engine = nullptr;
+    vector<Slot>           slots;
     uint32_t               width = 0;
     uint32_t               height = 0;
-    float                  psize[2];         //picture size
     bool                   updated = false;
     struct {
-        std::function<bool(Paint* paint, const char* src, void* data)> func;
-        val data; //user data for JS data type
+        AssetResolverCallback func = AssetResolverCallback(val::undefined());
+        val data = val::undefined();
     } resolver;
 };
 
+#endif
+
 
 // 0: success, 1: fail, 2: wait for async request
 int init()
@@ -579,24 +2537,72 @@ int init()
 }
 
 
+// compiles the render pipelines of the wg engine ahead of the first frame. 0: success (or no wg engine), 1: fail, 2: wait for async request
+int warmup()
+{
+#ifdef THORVG_WG_RASTER_SUPPORT
+    return TvgWgEngine::warmup();
+#else
+    return 0;
+#endif
+}
+
+
+// terminates the shared engine context, the animations must be destroyed before
 void term()
 {
+#ifdef THORVG_WG_RASTER_SUPPORT
+    TvgWgEngine::drop();
+#endif
+    termEngine();
 #ifdef THORVG_WG_RASTER_SUPPORT
     TvgWgEngine::term();
 #endif
 }
 
 
+// frees the idle target buffers pooled in the module, returns the freed bytes
+uint32_t trim()
+{
+    return trimEngine();
+}
+
+
+// the GPUDevice of the wg engine, to create the textures to attach() on it (undefined without the wg engine)
+val gpuDevice()
+{
+#ifdef THORVG_WG_RASTER_SUPPORT
+    if (device) return val::take_ownership(exportDevice(device));
+#endif
+    return val::undefined();
+}
+
+
+// register an OffscreenCanvas as the target of the selector, call it before creating the TvgLottieAnimation with the selector
+void offscreen(string selector, val canvas)
+{
+    bindCanvas(selector.c_str(), canvas.as_handle());
+}
+
+
 EMSCRIPTEN_BINDINGS(thorvg_bindings)
 {
     register_type<ArrayBuffer>("ArrayBuffer");
     register_type<Float32Array>("Float32Array");
+    register_type<Int32Array>("Int32Array");
+    register_type<Uint32Array>("Uint32Array");
     register_type<AssetResolverCallback>("(src: string, data: unknown) => { name: string, buffer: ArrayBuffer, mimetype: string }");
 
     emscripten::function("init", &init);
     emscripten::function("term", &term);
+    emscripten::function("trim", &trim);
+    emscripten::function("warmup", &warmup);
+    emscripten::function("offscreen", &offscreen);
+#ifdef THORVG_WG_RASTER_SUPPORT
+    emscripten::function("device", &gpuDevice);
+#endif
 
-    class_<TvgLottieAnimation>("TvgLottieAnimation")
+    auto animation = class_<TvgLottieAnimation>("TvgLottieAnimation")
         .constructor<string, string>()
         .function("error", &TvgLottieAnimation ::error, allow_raw_pointers())
         .function("size", &TvgLottieAnimation ::size)
@@ -604,12 +2610,82 @@ EMSCRIPTEN_BINDINGS(thorvg_bindings)
         .function("totalFrame", &TvgLottieAnimation ::totalFrame)
         .function("curFrame", &TvgLottieAnimation ::curFrame)
         .function("render", &TvgLottieAnimation::render)
+        .function("generation", &TvgLottieAnimation::generation)
+        .function("markers", &TvgLottieAnimation::markers)
+        .function("segment", &TvgLottieAnimation::segment)
+        .function("marker", &TvgLottieAnimation::marker)
+        .function("hold", &TvgLottieAnimation::hold)
         .function("load", &TvgLottieAnimation ::load)
+        .function("allocate", &TvgLottieAnimation ::allocate)
+        .function("loadBuffer", &TvgLottieAnimation ::loadBuffer)
+        .function("beginLoad", &TvgLottieAnimation ::beginLoad)
+        .function("appendChunk", &TvgLottieAnimation ::appendChunk)
+        .function("endLoad", &TvgLottieAnimation ::endLoad)
+        .function("cancelLoad", &TvgLottieAnimation ::cancelLoad)
         .function("update", &TvgLottieAnimation ::update)
         .function("frame", &TvgLottieAnimation ::frame)
         .function("viewport", &TvgLottieAnimation ::viewport)
         .function("resize", &TvgLottieAnimation ::resize)
         .function("save", &TvgLottieAnimation ::save)
         .function("quality", &TvgLottieAnimation ::quality)
+        .function("handle", &TvgLottieAnimation ::handle)
+        .function("memoryUsage", &TvgLottieAnimation ::memoryUsage)
+        .function("trim", &TvgLottieAnimation ::trim)
+        .function("scratchLimit", &TvgLottieAnimation ::scratchLimit)
+        .class_function("schedule", &TvgLottieAnimation::schedule)
+        .class_function("tick", &TvgLottieAnimation::tick)
+        .function("adaptive", &TvgLottieAnimation ::adaptive)
+        .function("frameRate", &TvgLottieAnimation ::frameRate)
+        .function("resolution", &TvgLottieAnimation ::resolution)
+        .function("enableStats", &TvgLottieAnimation ::enableStats)
+        .function("stats", &TvgLottieAnimation ::stats)
         .function("setAssetResolver", &TvgLottieAnimation ::setAssetResolver);
+
+    //the pixels in the wasm memory and what's built on them: the frame cache, the hold detection and the uploads
+#ifdef THORVG_SW_RASTER_SUPPORT
+    animation
+        .function("damage", &TvgLottieAnimation::damage)
+        .function("region", &TvgLottieAnimation::region)
+        .function("buffer", &TvgLottieAnimation::buffer)
+        .function("bytes", &TvgLottieAnimation::bytes)
+        .function("renderToTexture", &TvgLottieAnimation::renderToTexture)
+        .function("colorSpace", &TvgLottieAnimation ::colorSpace)
+        .function("detectHolds", &TvgLottieAnimation ::detectHolds)
+        .function("cacheBudget", &TvgLottieAnimation ::cacheBudget)
+        .function("cacheStats", &TvgLottieAnimation ::cacheStats)
+        .function("recordUpload", &TvgLottieAnimation ::recordUpload);
+#endif
+
+#ifdef THORVG_GL_RASTER_SUPPORT
+    animation.function("bitmap", &TvgLottieAnimation::bitmap);
+#endif
+
+#if defined(THORVG_GL_RASTER_SUPPORT) || defined(THORVG_WG_RASTER_SUPPORT)
+    animation.function("attach", &TvgLottieAnimation::attach);
+#endif
+
+#ifdef THORVG_WASM_EXPORT
+    animation
+        .function("exportBegin", &TvgLottieAnimation ::exportBegin)
+        .function("exportNext", &TvgLottieAnimation ::exportNext)
+        .function("exportEnd", &TvgLottieAnimation ::exportEnd)
+        .function("exportFrames", &TvgLottieAnimation ::exportFrames);
+#endif
+
+#ifndef THORVG_WASM_SPECIALIZED
+    class_<TvgLottieBatch>("TvgLottieBatch")
+        .constructor<string, string>()
+        .function("error", &TvgLottieBatch ::error, allow_raw_pointers())
+        .function("add", &TvgLottieBatch ::add)
+        .function("remove", &TvgLottieBatch ::remove)
+        .function("place", &TvgLottieBatch ::place)
+        .function("setAssetResolver", &TvgLottieBatch ::setAssetResolver)
+        .function("duration", &TvgLottieBatch ::duration)
+        .function("totalFrame", &TvgLottieBatch ::totalFrame)
+        .function("frame", &TvgLottieBatch ::frame)
+        .function("frames", &TvgLottieBatch ::frames)
+        .function("resize", &TvgLottieBatch ::resize)
+        .function("update", &TvgLottieBatch ::update)
+        .function("render", &TvgLottieBatch ::render);
+#endif
 }
@@ -44,9 +44,10 @@
 
 import { getModule } from '../core/Module';
 import { Paint } from '../paint/Paint';
-import type { RendererType } from '../constants';
+import type { RendererType, ColorSpaceType } from '../constants';
 import { checkResult } from '../core/errors';
-import type { TvgCanvasInstance } from '../types/emscripten';
+import { CommandBuffer } from './CommandBuffer';
+import type { TvgCanvasInstance, RenderStats } from '../types/emscripten';
 
 const DEFAULT_RENDERER: RendererType = 'gl';
 
@@ -62,6 +63,15 @@ export interface CanvasOptions {
   width?: number;
   /** Canvas height in pixels. Default: 600 */
   height?: number;
+  /** Collect the frame timings and counters reported by {@link Canvas.stats}. Default: false */
+  stats?: boolean;
+  /**
+   * Pixel format of the software renderer output. Default: 'abgr8888s'
+   *
+   * The other formats are for compositing the {@link Canvas.pixels} yourself, i.e. into a WebGL texture,
+   * they are not copied to the HTML canvas.
+   */
+  colorSpace?: ColorSpaceType;
 }
 
 /**
@@ -109,6 +119,11 @@ export class Canvas {
   #engine: TvgCanvasInstance | null = null;
   #renderer: RendererType = DEFAULT_RENDERER;
   #htmlCanvas: HTMLCanvasElement | null = null;
+  #stats: boolean = false;
+  #colorSpace: ColorSpaceType = 'abgr8888s';
+  #commands: CommandBuffer | null = null;
+  #handles: number = 0; // WASM memory of the handles to release, see releaseShapes()
+  #handlesCapacity: number = 0;
 
   /**
    * Creates a new Canvas rendering context.
@@ -135,7 +150,7 @@ export class Canvas {
    * ```
    */
   constructor(selector: string, options: CanvasOptions = {}) {
-    const { renderer = DEFAULT_RENDERER, width = 800, height = 600 } = options;
+    const { renderer = DEFAULT_RENDERER, width = 800, height = 600, stats = false, colorSpace = 'abgr8888s' } = options;
 
     // Module should already be initialized by ThorVG.init()
     const Module = getModule();
@@ -158,6 +173,15 @@ export class Canvas {
 
     this.#renderer = renderer;
     this.#htmlCanvas = document.querySelector(selector);
+    this.#stats = stats;
+    this.#engine.enableStats(stats);
+
+    if (colorSpace !== 'abgr8888s') {
+      if (renderer !== 'sw' || !this.#engine.colorSpace(colorSpace)) {
+        throw new Error(`The ${colorSpace} color space requires the sw renderer: ${this.#engine.error()}`);
+      }
+      this.#colorSpace = colorSpace;
+    }
   }
 
   /**
@@ -242,11 +266,8 @@ export class Canvas {
       return this;
     }
 
-    const Module = getModule();
-
     this.#engine.clear();
-    Module._tvg_canvas_draw(this.#ptr, 1);
-    Module._tvg_canvas_sync(this.#ptr);
+    this.#engine.draw();
 
     // For SW backend, also clear the HTML canvas
     if (this.#renderer === 'sw' && this.#htmlCanvas) {
@@ -281,9 +302,7 @@ export class Canvas {
    * For animated content, always call update() before render().
    */
   public update(): this {
-    const Module = getModule();
-    const result = Module._tvg_canvas_update(this.#ptr);
-    checkResult(result, 'update');
+    checkResult(this.#engine!.update(), 'update');
     return this;
   }
 
@@ -315,10 +334,51 @@ export class Canvas {
    * For static scenes, render() can be called directly.
    */
   public render(): this {
-    const Module = getModule();
+    this.#engine!.draw();
 
-    Module._tvg_canvas_draw(this.#ptr, 1);
-    Module._tvg_canvas_sync(this.#ptr);
+    // For SW backend, copy to HTML canvas
+    if (this.#renderer === 'sw') {
+      this._updateHTMLCanvas();
+    }
+
+    return this;
+  }
+
+  /**
+   * Starts rendering the next frame without waiting for it.
+   *
+   * With the multi-threaded build the frame is rasterized in the worker threads meanwhile,
+   * so the main thread can do other work until {@link endFrame}. The software renderer renders
+   * into a second target buffer, the previous frame stays intact while the next one is rendered.
+   *
+   * @returns The canvas instance for method chaining
+   *
+   * @example
+   * ```typescript
+   * function animate() {
+   *   animation.frame(currentFrame++);
+   *   canvas.update().beginFrame();
+   *   // ...other work of the frame
+   *   canvas.endFrame();
+   *   requestAnimationFrame(animate);
+   * }
+   * ```
+   *
+   * @remarks
+   * Don't modify the Paint objects until {@link endFrame}.
+   */
+  public beginFrame(): this {
+    this.#engine!.beginFrame();
+    return this;
+  }
+
+  /**
+   * Waits for the frame started by {@link beginFrame} and presents it.
+   *
+   * @returns The canvas instance for method chaining
+   */
+  public endFrame(): this {
+    this.#engine!.endFrame();
 
     // For SW backend, copy to HTML canvas
     if (this.#renderer === 'sw') {
@@ -328,12 +388,36 @@ export class Canvas {
     return this;
   }
 
+  /**
+   * Returns the pixels of the last rendered frame of the software renderer, in the {@link CanvasOptions.colorSpace} format.
+   *
+   * The view is over the WASM memory without a copy, valid until the next {@link render}, {@link endFrame} or {@link resize}.
+   *
+   * @returns The pixels, or undefined for the GPU renderers or before the first frame
+   *
+   * @example
+   * ```typescript
+   * const canvas = new TVG.Canvas('#canvas', { renderer: 'sw', colorSpace: 'abgr8888' });
+   * canvas.update().render();
+   * gl.texSubImage2D(gl.TEXTURE_2D, 0, 0, 0, width, height, gl.RGBA, gl.UNSIGNED_BYTE, canvas.pixels()!);
+   * ```
+   */
+  public pixels(): Uint8Array | undefined {
+    const buffer = this.#engine?.output();
+    return buffer ? new Uint8Array(buffer.buffer, buffer.byteOffset, buffer.byteLength) : undefined;
+  }
+
   private _updateHTMLCanvas(): void {
     if (!this.#engine || !this.#htmlCanvas) return;
 
-    const buffer = this.#engine.render() as unknown as ArrayBuffer; //TODO: FIX
+    // only the default format is what ImageData takes
+    if (this.#colorSpace !== 'abgr8888s') return;
+
+    const buffer = this.#engine.output();
+    if (!buffer) return;
     const size = this.#engine.size();
-    
+
+    const begin = this.#stats ? performance.now() : 0;
     const ctx = this.#htmlCanvas.getContext('2d') as CanvasRenderingContext2D;
     const imageData = new ImageData(
       new Uint8ClampedArray(buffer),
@@ -341,6 +425,106 @@ export class Canvas {
       size.height
     );
     ctx.putImageData(imageData, 0, 0);
+
+    if (this.#stats) {
+      this.#engine.recordUpload(performance.now() - begin);
+    }
+  }
+
+  /**
+   * Returns the frame timings and the rendering counters, collected when the canvas is created with the `stats` option.
+   *
+   * The phase timings (update, draw, sync, and upload to the HTML canvas for the software renderer) are
+   * min/avg/p95/max in milliseconds over the recent 120 frames.
+   *
+   * @example
+   * ```typescript
+   * const canvas = new TVG.Canvas('#canvas', { renderer: 'sw', stats: true });
+   * // ...
+   * const { draw, upload, frames } = canvas.stats();
+   * console.log(`draw p95: ${draw.p95}ms, upload p95: ${upload.p95}ms over ${frames} frames`);
+   * ```
+   */
+  public stats(): RenderStats {
+    return this.#engine!.stats();
+  }
+
+  /**
+   * Returns the command buffer of the canvas, which records the changes of the paints and applies them
+   * all in a single WASM call. Calling render() per paint change is not needed, {@link CommandBuffer.submit}
+   * applies the commands, then updates and renders the canvas.
+   *
+   * @param capacity - The buffer size in 32-bit words (default: 65536), once it's full the recorded commands are applied early
+   *
+   * @example
+   * ```typescript
+   * const commands = canvas.commands();
+   * particles.forEach((shape, i) => commands.translate(shape, xs[i], ys[i]).opacity(shape, alphas[i]));
+   * commands.submit();
+   * ```
+   */
+  public commands(capacity: number = 65536): CommandBuffer {
+    if (!this.#commands) {
+      this.#commands = new CommandBuffer((ptr, length, render) => {
+        const result = this.#engine!.submit(ptr, length, render);
+        if (render && this.#renderer === 'sw') this._updateHTMLCanvas();
+        return result;
+      }, capacity);
+    }
+    return this.#commands;
+  }
+
+  /**
+   * Hands out pooled shapes drawn on top of the canvas, for paints spawned and dropped at a high rate (i.e. particles).
+   *
+   * The shapes are handles instead of {@link Shape} objects,
+   * so nothing is allocated or tracked by the FinalizationRegistry per shape. Their paths are built and changed with
+   * the {@link CommandBuffer}. {@link releaseShapes} resets and hides them for the next acquireShapes(), instead of
+   * freeing them, so a steady state allocates nothing. The fill and the stroke of a reused shape carry over.
+   *
+   * @param count - The number of the shapes
+   * @returns The handles, a view over the WASM memory valid until the next call, copy it to keep it
+   *
+   * @example
+   * ```typescript
+   * const commands = canvas.commands();
+   * const spawned = canvas.acquireShapes(100).slice();
+   * spawned.forEach((shape) => commands.appendCircle(shape, x, y, 4).fill(shape, 255, 128, 0));
+   * commands.submit();
+   * // ...once they're gone
+   * canvas.releaseShapes(spawned);
+   * ```
+   *
+   * @remarks
+   * Don't remove the pooled shapes one by one, {@link remove | remove()} without arguments and clear() drop all of them.
+   */
+  public acquireShapes(count: number): Uint32Array {
+    const ptr = this.#engine!.acquireShapes(count);
+    if (!ptr) return new Uint32Array(0);
+    return new Uint32Array(getModule().HEAPU8.buffer, ptr, count);
+  }
+
+  /**
+   * Gives back the pooled shapes of {@link acquireShapes} for reuse. Unknown and already released handles are skipped.
+   *
+   * @param handles - The handles of the shapes to release
+   * @returns The number of the released shapes
+   */
+  public releaseShapes(handles: Uint32Array): number {
+    if (handles.length === 0) return 0;
+    const Module = getModule();
+
+    // in place if the handles are in the WASM memory already, otherwise through a grow-only buffer
+    if (handles.buffer === Module.HEAPU8.buffer) {
+      return this.#engine!.releaseShapes(handles.byteOffset, handles.length);
+    }
+    if (this.#handlesCapacity < handles.length) {
+      if (this.#handles) Module._free(this.#handles);
+      this.#handles = Module._malloc(handles.length * 4);
+      this.#handlesCapacity = handles.length;
+    }
+    new Uint32Array(Module.HEAPU8.buffer, this.#handles, handles.length).set(handles);
+    return this.#engine!.releaseShapes(this.#handles, handles.length);
   }
 
   /**
@@ -417,6 +601,17 @@ export class Canvas {
     // Clear all paints from canvas
     this.clear();
 
+    if (this.#commands) {
+      this.#commands.dispose();
+      this.#commands = null;
+    }
+
+    if (this.#handles) {
+      getModule()._free(this.#handles);
+      this.#handles = 0;
+      this.#handlesCapacity = 0;
+    }
+
     // Delete canvas
     if (this.#ptr) {
       // Canvas is deleted automatically by ThorVGEngine
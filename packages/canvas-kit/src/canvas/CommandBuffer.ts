@@ -0,0 +1,209 @@
+/**
+ * Command buffer for submitting a frame of scene changes to a Canvas in a single WASM call.
+ *
+ * Every Paint method crosses the JS to WASM boundary once. For scenes changing thousands of
+ * paints per frame, the command buffer records the changes into WASM memory instead and the
+ * canvas applies all of them in one call on {@link CommandBuffer.submit}.
+ *
+ * @category Canvas
+ *
+ * @example
+ * ```typescript
+ * const commands = canvas.commands();
+ *
+ * function animate() {
+ *   for (const [i, bar] of bars.entries()) {
+ *     commands.reset(bar).appendRect(bar, i * 10, 600 - values[i], 8, values[i]).fill(bar, 51, 102, 255);
+ *   }
+ *   commands.submit(); // applies, updates and renders
+ *   requestAnimationFrame(animate);
+ * }
+ * ```
+ */
+
+import { getModule } from '../core/Module';
+import { checkResult } from '../core/errors';
+import type { Paint } from '../paint/Paint';
+
+// Opcodes, must be in sync with TvgCmd of the canvas kit binding
+const enum Cmd {
+  MoveTo = 0,
+  LineTo,
+  CubicTo,
+  Close,
+  Reset,
+  AppendRect,
+  AppendCircle,
+  Fill,
+  StrokeWidth,
+  StrokeFill,
+  Translate,
+  Rotate,
+  Scale,
+  Opacity,
+  Transform,
+}
+
+const _packColor = (r: number, g: number, b: number, a: number): number =>
+  ((r & 0xff) | ((g & 0xff) << 8) | ((b & 0xff) << 16) | ((a & 0xff) << 24)) >>> 0;
+
+/** A Paint object, or the handle of a pooled shape of {@link Canvas.acquireShapes} */
+export type PaintRef = Paint | number;
+
+/** @internal Applies the recorded words of the buffer, and renders the canvas if requested */
+export type SubmitFunction = (ptr: number, length: number, render: boolean) => number;
+
+export class CommandBuffer {
+  #submit: SubmitFunction;
+  #ptr: number;
+  #capacity: number;
+  #length: number = 0;
+  #u32: Uint32Array;
+  #f32: Float32Array;
+
+  /**
+   * @internal Use {@link Canvas.commands} to get the command buffer of a canvas.
+   * @param capacity - The size of the buffer in 32-bit words, recorded commands are applied early once it's full
+   */
+  constructor(submit: SubmitFunction, capacity: number) {
+    const Module = getModule();
+    this.#submit = submit;
+    this.#capacity = capacity;
+    this.#ptr = Module._malloc(capacity * 4);
+    this.#u32 = new Uint32Array(Module.HEAPU8.buffer, this.#ptr, capacity);
+    this.#f32 = new Float32Array(Module.HEAPU8.buffer, this.#ptr, capacity);
+  }
+
+  // Reserve the room of a command and return its offset
+  #record(cmd: Cmd, paint: PaintRef, size: number): number {
+    if (this.#length + 2 + size > this.#capacity) {
+      this.#flush(false);
+    }
+
+    // The views are detached once the WASM memory grows
+    if (this.#u32.buffer !== getModule().HEAPU8.buffer) {
+      const { buffer } = getModule().HEAPU8;
+      this.#u32 = new Uint32Array(buffer, this.#ptr, this.#capacity);
+      this.#f32 = new Float32Array(buffer, this.#ptr, this.#capacity);
+    }
+
+    const offset = this.#length;
+    this.#u32[offset] = cmd;
+    this.#u32[offset + 1] = typeof paint === 'number' ? paint : paint.ptr;
+    this.#length += 2 + size;
+    return offset + 2;
+  }
+
+  #floats(cmd: Cmd, paint: PaintRef, ...args: number[]): this {
+    const offset = this.#record(cmd, paint, args.length);
+    this.#f32.set(args, offset);
+    return this;
+  }
+
+  #flush(render: boolean): void {
+    const length = this.#length;
+    this.#length = 0;
+    checkResult(this.#submit(this.#ptr, length, render), 'submit');
+  }
+
+  public moveTo(shape: PaintRef, x: number, y: number): this {
+    return this.#floats(Cmd.MoveTo, shape, x, y);
+  }
+
+  public lineTo(shape: PaintRef, x: number, y: number): this {
+    return this.#floats(Cmd.LineTo, shape, x, y);
+  }
+
+  public cubicTo(shape: PaintRef, cx1: number, cy1: number, cx2: number, cy2: number, x: number, y: number): this {
+    return this.#floats(Cmd.CubicTo, shape, cx1, cy1, cx2, cy2, x, y);
+  }
+
+  public close(shape: PaintRef): this {
+    this.#record(Cmd.Close, shape, 0);
+    return this;
+  }
+
+  /** Remove the path of the shape */
+  public reset(shape: PaintRef): this {
+    this.#record(Cmd.Reset, shape, 0);
+    return this;
+  }
+
+  public appendRect(shape: PaintRef, x: number, y: number, w: number, h: number, rx: number = 0, ry: number = 0, clockwise: boolean = true): this {
+    const offset = this.#record(Cmd.AppendRect, shape, 7);
+    this.#f32.set([x, y, w, h, rx, ry], offset);
+    this.#u32[offset + 6] = clockwise ? 1 : 0;
+    return this;
+  }
+
+  public appendCircle(shape: PaintRef, cx: number, cy: number, rx: number, ry: number = rx, clockwise: boolean = true): this {
+    const offset = this.#record(Cmd.AppendCircle, shape, 5);
+    this.#f32.set([cx, cy, rx, ry], offset);
+    this.#u32[offset + 4] = clockwise ? 1 : 0;
+    return this;
+  }
+
+  public fill(shape: PaintRef, r: number, g: number, b: number, a: number = 255): this {
+    this.#u32[this.#record(Cmd.Fill, shape, 1)] = _packColor(r, g, b, a);
+    return this;
+  }
+
+  public strokeWidth(shape: PaintRef, width: number): this {
+    return this.#floats(Cmd.StrokeWidth, shape, width);
+  }
+
+  public strokeFill(shape: PaintRef, r: number, g: number, b: number, a: number = 255): this {
+    this.#u32[this.#record(Cmd.StrokeFill, shape, 1)] = _packColor(r, g, b, a);
+    return this;
+  }
+
+  public translate(paint: PaintRef, x: number, y: number): this {
+    return this.#floats(Cmd.Translate, paint, x, y);
+  }
+
+  public rotate(paint: PaintRef, degree: number): this {
+    return this.#floats(Cmd.Rotate, paint, degree);
+  }
+
+  public scale(paint: PaintRef, factor: number): this {
+    return this.#floats(Cmd.Scale, paint, factor);
+  }
+
+  /** @param opacity - 0 (transparent) to 1 (opaque) */
+  public opacity(paint: PaintRef, opacity: number): this {
+    this.#u32[this.#record(Cmd.Opacity, paint, 1)] = Math.floor(Math.max(0, Math.min(1, opacity)) * 255);
+    return this;
+  }
+
+  /** @param matrix - 3x3 matrix in row-major order */
+  public transform(paint: PaintRef, matrix: ArrayLike<number>): this {
+    const offset = this.#record(Cmd.Transform, paint, 9);
+    this.#f32.set(Array.from(matrix).slice(0, 9), offset);
+    return this;
+  }
+
+  /**
+   * Apply the recorded commands, then update and render the canvas.
+   */
+  public submit(): void {
+    this.#flush(true);
+  }
+
+  /**
+   * Apply the recorded commands without rendering.
+   */
+  public apply(): void {
+    this.#flush(false);
+  }
+
+  /**
+   * Free the WASM memory of the buffer.
+   */
+  public dispose(): void {
+    if (this.#ptr) {
+      getModule()._free(this.#ptr);
+      this.#ptr = 0;
+      this.#length = 0;
+    }
+  }
+}
@@ -94,6 +94,16 @@ export enum TextWrapMode {
  */
 export type RendererType = 'sw' | 'gl' | 'wg' | 'auto';
 
+/**
+ * Pixel format of the software renderer output.
+ * - `'abgr8888s'`: RGBA bytes with straight alpha, as `ImageData` takes them (default)
+ * - `'argb8888s'`: BGRA bytes with straight alpha
+ * - `'abgr8888'`: RGBA bytes with premultiplied alpha, i.e. for a WebGL texture with `UNPACK_PREMULTIPLY_ALPHA_WEBGL` off
+ * - `'argb8888'`: BGRA bytes with premultiplied alpha
+ * @category Canvas
+ */
+export type ColorSpaceType = 'abgr8888s' | 'argb8888s' | 'abgr8888' | 'argb8888';
+
 /**
  * Stroke cap style for line endings.
  * - `'butt'`: Flat cap at the exact endpoint
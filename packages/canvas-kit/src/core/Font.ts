@@ -5,7 +5,7 @@
  */
 
 import { getModule } from './Module';
-import { checkResult } from './errors';
+import { checkResult, ThorVGResultCode } from './errors';
 
 /**
  * Supported font file formats.
@@ -23,8 +23,13 @@ export interface LoadFontOptions {
   format?: FontFormat;
   /** Whether to copy the data (default: true) */
   copy?: boolean;
+  /** Share the font among the canvases through the module-wide asset cache, the same name and data are loaded once (default: false) */
+  shared?: boolean;
 }
 
+// handles of the shared fonts by name, released by unload()
+const sharedFonts = new Map<string, number[]>();
+
 /**
  * Font loader utility
  * Fonts are loaded globally and can be referenced by name in Text objects
@@ -79,7 +84,16 @@ export class Font {
    */
   public static load(name: string, data: Uint8Array, options: LoadFontOptions = {}): void {
     const Module = getModule();
-    const { format = 'ttf', copy = true } = options;
+    const { format = 'ttf', copy = true, shared = false } = options;
+
+    if (shared) {
+      const handle = Module.retainFont(name, data, format);
+      if (!handle) {
+        checkResult(ThorVGResultCode.InvalidArguments, `Font.load("${name}")`);
+      }
+      sharedFonts.set(name, [...(sharedFonts.get(name) ?? []), handle]);
+      return;
+    }
 
     // Allocate memory for font name
     const namePtr = Module._malloc(name.length + 1);
@@ -132,6 +146,15 @@ export class Font {
   public static unload(name: string): void {
     const Module = getModule();
 
+    const handles = sharedFonts.get(name);
+    if (handles) {
+      Module.releaseFont(handles.pop()!);
+      if (handles.length === 0) {
+        sharedFonts.delete(name);
+      }
+      return;
+    }
+
     const namePtr = Module._malloc(name.length + 1);
     Module.HEAPU8.set(new TextEncoder().encode(name), namePtr);
     Module.HEAPU8[namePtr + name.length] = 0;
@@ -241,6 +241,8 @@ export { init, Canvas, Shape, Scene, Picture, Text, Animation, LinearGradient, R
 
 // Re-export types
 export type { CanvasOptions } from './canvas/Canvas';
+export type { CommandBuffer, PaintRef } from './canvas/CommandBuffer';
+export type { RenderStats, PhaseStats } from './types/emscripten';
 export type { Bounds } from './paint/Paint';
 export type { RectOptions, StrokeOptions } from './paint/Shape';
 export type { LoadDataOptions, PictureFormat, PictureSize } from './paint/Picture';
@@ -249,7 +251,7 @@ export type { AnimationInfo, AnimationSegment } from './animation/Animation';
 export type { LoadFontOptions, FontFormat } from './core/Font';
 export type { ColorStop } from './fill/Fill';
 /** @category Canvas */
-export type { RendererType } from './constants';
+export type { RendererType, ColorSpaceType } from './constants';
 /** @category Shape */
 export type { StrokeCapType, StrokeJoinType, FillRuleType } from './constants';
 /** @category Gradients */
@@ -101,6 +101,11 @@ export class Text extends Paint {
   public font(name: string): this {
     const Module = getModule();
 
+    // The embedded font is registered on its first use
+    if (name === 'default') {
+      Module.defaultFont();
+    }
+
     const namePtr = Module._malloc(name.length + 1);
     Module.HEAPU8.set(new TextEncoder().encode(name), namePtr);
     Module.HEAPU8[namePtr + name.length] = 0;
@@ -21,6 +21,11 @@ export interface EmscriptenModule {
   init(): number;
   term(): void;
 
+  // Module-wide shared fonts (Embind)
+  defaultFont(): boolean;
+  retainFont(name: string, data: Uint8Array, format: string): number;
+  releaseFont(handle: number): void;
+
   // TvgCanvas class (Embind)
   TvgCanvas: TvgCanvasConstructor;
 }
@@ -38,12 +43,43 @@ export interface TvgCanvasInstance {
   error(): string;
   resize(width: number, height: number): boolean;
   clear(): boolean;
+  colorSpace(name: string): boolean;
   render(): Uint8ClampedArray | undefined;
+  output(): Uint8ClampedArray | undefined;
+  beginFrame(): number;
+  endFrame(): Uint8ClampedArray | undefined;
   size(): { width: number; height: number };
+  update(): number;
+  draw(): number;
+  enableStats(on: boolean): void;
+  stats(): RenderStats;
+  recordUpload(ms: number): void;
+  submit(ptr: number, length: number, render: boolean): number;
+  acquireShapes(count: number): number;
+  releaseShapes(ptr: number, count: number): number;
   ptr(): number;
   delete(): void;
 }
 
+export interface PhaseStats {
+  min: number;
+  avg: number;
+  p95: number;
+  max: number;
+}
+
+export interface RenderStats {
+  frame: PhaseStats;
+  update: PhaseStats;
+  draw: PhaseStats;
+  sync: PhaseStats;
+  upload: PhaseStats;
+  frames: number;
+  paints: number;
+  bytes: number;
+  reallocs: number;
+}
+
 // CAPI function signatures
 export interface ThorVGCAPI {
   // Canvas functions
@@ -17,6 +17,19 @@ fi
 # Remove trailing slash from EMSDK path
 EMSDK="${EMSDK%/}"
 
+# THREADS: the number of the SW rasterizer workers preallocated in the pthread pool (default: 0, single-threaded)
+THREADS="${THREADS:-0}"
+if [ "$THREADS" -gt 0 ]; then
+  PTHREAD="s|cpp_args = \[|cpp_args = ['-pthread', |g"
+  TVG_THREADS="true"
+else
+  PTHREAD=""
+  TVG_THREADS="false"
+fi
+
+# DEFAULT_FONT: embed the default font (default: true), false leaves it out for a smaller module
+DEFAULT_FONT="${DEFAULT_FONT:-true}"
+
 # Define exported functions for Canvas Kit
 EXPORTED_FUNCTIONS="_tvg_engine_init,_tvg_engine_term,_tvg_swcanvas_create,_tvg_swcanvas_set_target,_tvg_glcanvas_create,_tvg_wgcanvas_create,_tvg_canvas_destroy,_tvg_canvas_push,_tvg_canvas_push_at,_tvg_canvas_remove,_tvg_canvas_draw,_tvg_canvas_sync,_tvg_canvas_update,_tvg_canvas_set_viewport,_tvg_shape_new,_tvg_shape_reset,_tvg_shape_move_to,_tvg_shape_line_to,_tvg_shape_cubic_to,_tvg_shape_close,_tvg_shape_append_rect,_tvg_shape_append_circle,_tvg_shape_append_path,_tvg_shape_get_path,_tvg_shape_set_fill_color,_tvg_shape_get_fill_color,_tvg_shape_set_fill_rule,_tvg_shape_get_fill_rule,_tvg_shape_set_stroke_width,_tvg_shape_get_stroke_width,_tvg_shape_set_stroke_color,_tvg_shape_get_stroke_color,_tvg_shape_set_stroke_join,_tvg_shape_get_stroke_join,_tvg_shape_set_stroke_cap,_tvg_shape_get_stroke_cap,_tvg_shape_set_stroke_gradient,_tvg_shape_get_stroke_gradient,_tvg_shape_set_stroke_dash,_tvg_shape_get_stroke_dash,_tvg_shape_set_gradient,_tvg_shape_get_gradient,_tvg_paint_rel,_tvg_paint_ref,_tvg_paint_unref,_tvg_paint_get_ref,_tvg_paint_duplicate,_tvg_paint_set_transform,_tvg_paint_get_transform,_tvg_paint_translate,_tvg_paint_scale,_tvg_paint_rotate,_tvg_paint_set_opacity,_tvg_paint_get_opacity,_tvg_paint_get_aabb,_tvg_paint_get_type,_tvg_paint_set_blend_method,_tvg_linear_gradient_new,_tvg_linear_gradient_set,_tvg_linear_gradient_get,_tvg_radial_gradient_new,_tvg_radial_gradient_set,_tvg_radial_gradient_get,_tvg_gradient_set_color_stops,_tvg_gradient_get_color_stops,_tvg_gradient_set_spread,_tvg_gradient_get_spread,_tvg_gradient_del,_tvg_scene_new,_tvg_scene_push,_tvg_scene_push_at,_tvg_scene_remove,_tvg_picture_new,_tvg_picture_load,_tvg_picture_load_raw,_tvg_picture_load_data,_tvg_picture_set_size,_tvg_picture_get_size,_tvg_animation_new,_tvg_animation_set_frame,_tvg_animation_get_picture,_tvg_animation_get_frame,_tvg_animation_get_total_frame,_tvg_animation_get_duration,_tvg_animation_set_segment,_tvg_animation_get_segment,_tvg_animation_del,_tvg_text_new,_tvg_text_set_font,_tvg_text_set_size,_tvg_text_set_text,_tvg_text_set_color,_tvg_text_set_gradient,_tvg_text_align,_tvg_text_layout,_tvg_text_wrap_mode,_tvg_text_set_italic,_tvg_text_set_outline,_tvg_font_load,_tvg_font_load_data,_tvg_font_unload,_malloc,_free"
 
@@ -32,7 +45,7 @@ rm -rf build_wasm_canvaskit
 # 2. Remove -fno-exceptions from cpp_args
 # 3. Remove --closure=1 and -sEXPORTED_RUNTIME_METHODS=FS from cpp_link_args
 # 4. Add Canvas Kit specific flags: EXPORTED_FUNCTIONS, EXPORTED_RUNTIME_METHODS, exception handling, and TypeScript definitions
-sed "s|EMSDK:|$EMSDK/|g" ./cross/wasm32.txt | \
+sed "s|EMSDK:|$EMSDK/|g; $PTHREAD" ./cross/wasm32.txt | \
   sed "s|, '-fno-exceptions'||g" | \
   sed "s|'-fno-exceptions', ||g" | \
   sed "s|, '--closure=1'||g" | \
@@ -45,7 +58,7 @@ meson setup \
   -Dstatic=true \
   -Dloaders="all" \
   -Dsavers="all" \
-  -Dthreads=false \
+  -Dthreads=$TVG_THREADS \
   -Dfile="false" \
   -Dbindings="capi" \
   -Dpartial=false \
@@ -71,7 +84,7 @@ cd ../packages/canvas-kit
 rm -rf build_wasm_canvaskit
 
 cp ../../thorvg/build_wasm_canvaskit/config.h ../../bindings/canvas_kit/config.h
-meson setup -Db_lto=true --cross-file /tmp/.wasm_canvaskit_cross.txt build_wasm_canvaskit ../../bindings/canvas_kit
+meson setup -Db_lto=true -Dthreads=$THREADS -Ddefault_font=$DEFAULT_FONT --cross-file /tmp/.wasm_canvaskit_cross.txt build_wasm_canvaskit ../../bindings/canvas_kit
 
 if [ $? -ne 0 ]; then
   echo "Canvas Kit bindings meson setup failed!"
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2025 the ThorVG project. All rights reserved.
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Headless benchmark of the sw builds in dist/ (see wasm_setup.sh) over the lottie files of examples/resources.
+// For every file and build it measures the load, the per frame frame()/update()/render() timings at each size,
+// the wasm heap and a checksum of the rendered pixels, and writes them as JSON.
+// With --batch <n>, it also renders n of the files at once in the tiles of a TvgLottieBatch.
+// With --baseline, it compares the result with a previous one and fails on the regressions.
+//
+//   node benchmark/bench.mjs [--builds sw,sw-lite,sw-mt] [--sizes 256,512,1024] [--frames 60] [--batch 40]
+//                            [--resources dir] [--out result.json] [--baseline prev.json] [--threshold 0.2]
+
+import { readFileSync, readdirSync, writeFileSync, existsSync } from 'node:fs';
+import { basename, dirname, join, resolve } from 'node:path';
+import { fileURLToPath, pathToFileURL } from 'node:url';
+import { performance } from 'node:perf_hooks';
+
+const root = resolve(dirname(fileURLToPath(import.meta.url)), '..');
+
+// timing differences below this (ms) are noise, not regressions
+const NOISE = 0.1;
+
+// the tile size of a batch slot
+const TILE = 128;
+
+const _options = (argv) => {
+  const options = {
+    builds: ['sw', 'sw-lite', 'sw-mt'],
+    sizes: [256, 512, 1024],
+    frames: 60,
+    batch: 0,
+    resources: resolve(root, '../../examples/resources'),
+    out: '',
+    baseline: '',
+    threshold: 0.2,
+  };
+
+  for (let i = 0; i < argv.length; i += 2) {
+    const [name, value] = [argv[i].replace(/^--/, ''), argv[i + 1]];
+    if (!(name in options) || value === undefined) {
+      throw new Error(`Unknown or incomplete option: ${argv[i]}`);
+    }
+    if (Array.isArray(options[name])) {
+      options[name] = value.split(',').map((item) => (typeof options[name][0] === 'number' ? Number(item) : item));
+    } else {
+      options[name] = typeof options[name] === 'number' ? Number(value) : value;
+    }
+  }
+  return options;
+};
+
+// min/avg/p95/max in milliseconds
+const _summary = (samples) => {
+  const sorted = [...samples].sort((a, b) => a - b);
+  const n = sorted.length;
+  const round = (value) => Math.round(value * 1000) / 1000;
+  if (n === 0) {
+    return { min: 0, avg: 0, p95: 0, max: 0 };
+  }
+  return {
+    min: round(sorted[0]),
+    avg: round(sorted.reduce((sum, value) => sum + value, 0) / n),
+    p95: round(sorted[Math.min(n - 1, Math.floor(n * 0.95))]),
+    max: round(sorted[n - 1]),
+  };
+};
+
+// FNV-1a over the pixels, to catch the rendering changes
+const _checksum = (hash, bytes) => {
+  for (let i = 0; i < bytes.length; ++i) {
+    hash ^= bytes[i];
+    hash = Math.imul(hash, 0x01000193) >>> 0;
+  }
+  return hash;
+};
+
+const _time = (callback) => {
+  const begin = performance.now();
+  const result = callback();
+  return [performance.now() - begin, result];
+};
+
+const _createModule = async (build) => {
+  const dir = join(root, 'dist', build);
+  const script = join(dir, 'thorvg.js');
+  if (!existsSync(script)) {
+    return null;
+  }
+
+  const { default: Module } = await import(pathToFileURL(script).href);
+  return Module({
+    wasmBinary: readFileSync(join(dir, 'thorvg.wasm')),
+    locateFile: (path) => join(dir, path),
+  });
+};
+
+const _bench = (module, file, options) => {
+  const data = readFileSync(file);
+  const TVG = new module.TvgLottieAnimation('sw', '');
+  const result = { file: basename(file) };
+
+  try {
+    const [size] = options.sizes;
+    const [load, loaded] = _time(() => {
+      const ptr = TVG.allocate(data.byteLength);
+      module.HEAPU8.set(data, ptr);
+      return TVG.loadBuffer('json', size, size);
+    });
+    if (!loaded) {
+      result.error = TVG.error();
+      return result;
+    }
+
+    result.load = Math.round(load * 1000) / 1000;
+    result.totalFrame = TVG.totalFrame();
+    result.duration = TVG.duration();
+    result.sizes = [];
+
+    for (const size of options.sizes) {
+      TVG.resize(size, size);
+
+      const frame = [];
+      const update = [];
+      const render = [];
+      let hash = 0x811c9dc5;
+
+      // spread the sampled frames over the whole animation
+      const count = Math.max(1, Math.min(options.frames, Math.ceil(result.totalFrame)));
+      for (let i = 0; i < count; ++i) {
+        const no = (result.totalFrame * i) / count;
+        frame.push(_time(() => TVG.frame(no))[0]);
+        update.push(_time(() => TVG.update())[0]);
+        render.push(_time(() => TVG.render())[0]);
+
+        // NOTE: render() may grow the memory, access HEAPU8 after it
+        const ptr = TVG.buffer();
+        hash = _checksum(hash, module.HEAPU8.subarray(ptr, ptr + TVG.bytes()));
+      }
+
+      result.sizes.push({
+        size,
+        frame: _summary(frame),
+        update: _summary(update),
+        render: _summary(render),
+        checksum: hash.toString(16).padStart(8, '0'),
+      });
+    }
+  } finally {
+    TVG.delete();
+  }
+
+  // the memory never shrinks, so it's the peak up to this file
+  result.heap = module.HEAPU8.buffer.byteLength;
+  return result;
+};
+
+// the animations of the files in the tiles of one canvas, advanced by frames() and rendered at once
+const _benchBatch = (module, files, options) => {
+  const columns = Math.ceil(Math.sqrt(options.batch));
+  const size = columns * TILE;
+  const batch = new module.TvgLottieBatch('sw', '');
+  const result = { file: `batch-${options.batch}` };
+
+  try {
+    batch.resize(size, size);
+
+    const totalFrames = [];
+    for (let i = 0; i < options.batch; ++i) {
+      const [x, y] = [(i % columns) * TILE, Math.floor(i / columns) * TILE];
+      const id = batch.add(readFileSync(files[i % files.length], 'utf8'), 'json', x, y, TILE, TILE);
+      if (id < 0) {
+        result.error = `${basename(files[i % files.length])}: ${batch.error()}`;
+        return result;
+      }
+      totalFrames[id] = batch.totalFrame(id);
+    }
+
+    const frame = [];
+    const update = [];
+    const render = [];
+    let hash = 0x811c9dc5;
+
+    for (let i = 0; i < options.frames; ++i) {
+      const nos = new Float32Array(totalFrames.map((totalFrame) => (totalFrame * i) / options.frames));
+      frame.push(_time(() => batch.frames(nos))[0]);
+      update.push(_time(() => batch.update())[0]);
+      const [time, pixels] = _time(() => batch.render());
+      render.push(time);
+      hash = _checksum(hash, new Uint8Array(pixels));
+    }
+
+    result.sizes = [{
+      size,
+      frame: _summary(frame),
+      update: _summary(update),
+      render: _summary(render),
+      checksum: hash.toString(16).padStart(8, '0'),
+    }];
+  } finally {
+    batch.delete();
+  }
+
+  result.heap = module.HEAPU8.buffer.byteLength;
+  return result;
+};
+
+// the regressions of the render time and the changed checksums against the baseline
+const _compare = (baseline, current, threshold) => {
+  const regressions = [];
+  const index = new Map();
+  for (const build of baseline.builds) {
+    for (const entry of build.results) {
+      for (const size of entry.sizes || []) {
+        index.set(`${build.build}/${entry.file}/${size.size}`, size);
+      }
+    }
+  }
+
+  for (const build of current.builds) {
+    for (const entry of build.results) {
+      for (const size of entry.sizes || []) {
+        const key = `${build.build}/${entry.file}/${size.size}`;
+        const base = index.get(key);
+        if (!base) {
+          continue;
+        }
+        const before = base.update.avg + base.render.avg;
+        const after = size.update.avg + size.render.avg;
+        if (after > before * (1 + threshold) && after - before > NOISE) {
+          regressions.push({ key, reason: 'time', before, after });
+        }
+        if (base.checksum !== size.checksum) {
+          regressions.push({ key, reason: 'checksum', before: base.checksum, after: size.checksum });
+        }
+      }
+    }
+  }
+  return regressions;
+};
+
+const main = async () => {
+  const options = _options(process.argv.slice(2));
+  const files = readdirSync(options.resources)
+    .filter((name) => name.endsWith('.json'))
+    .sort()
+    .map((name) => join(options.resources, name));
+
+  const report = {
+    date: new Date().toISOString(),
+    node: process.version,
+    sizes: options.sizes,
+    frames: options.frames,
+    builds: [],
+  };
+
+  for (const build of options.builds) {
+    const module = await _createModule(build);
+    if (!module) {
+      console.error(`skipping ${build}: dist/${build}/thorvg.js is not built`);
+      continue;
+    }
+
+    const results = [];
+    for (const file of files) {
+      results.push(_bench(module, file, options));
+      console.error(`${build} ${basename(file)}`);
+    }
+
+    if (options.batch > 0 && files.length > 0) {
+      results.push(_benchBatch(module, files, options));
+      console.error(`${build} batch of ${options.batch}`);
+    }
+
+    module.term?.();
+    report.builds.push({ build, results, heap: module.HEAPU8.buffer.byteLength });
+  }
+
+  const json = JSON.stringify(report, null, 2);
+  if (options.out) {
+    writeFileSync(options.out, json);
+  } else {
+    process.stdout.write(json + '\n');
+  }
+
+  if (options.baseline) {
+    const regressions = _compare(JSON.parse(readFileSync(options.baseline, 'utf8')), report, options.threshold);
+    for (const { key, reason, before, after } of regressions) {
+      console.error(`regression ${key}: ${reason} ${before} -> ${after}`);
+    }
+    if (regressions.length > 0) {
+      process.exitCode = 1;
+    }
+  }
+};
+
+main().catch((err) => {
+  console.error(err);
+  process.exitCode = 1;
+});
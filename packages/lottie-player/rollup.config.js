@@ -27,6 +27,7 @@ const PresetModule = {
   Default: "lottie-player",
   SW: "lottie-player-sw",
   GL: "lottie-player-gl",
+  SW_MT: "lottie-player-sw-mt",
   SW_LITE: "lottie-player-sw-lite",
   GL_LITE: "lottie-player-gl-lite",
 }
@@ -62,6 +63,17 @@ const presetMap = {
       esm: pkg.exports['./gl'].import,
     }
   },
+  [PresetModule.SW_MT]: {
+    path: '/dist/sw-mt',
+    fallback: '/dist/sw-mt/fallback',
+    renderer: 'sw',
+    input: "./src/lottie-preset-player.ts",
+    output: {
+      umd: './dist/sw-mt/lottie-player.js',
+      cjs: pkg.exports['./sw-mt'].require,
+      esm: pkg.exports['./sw-mt'].import,
+    }
+  },
   [PresetModule.SW_LITE]: {
     path: '/dist/sw-lite',
     renderer: 'sw',
@@ -114,6 +126,8 @@ const createLottieConfig = (preset) => {
       alias({
         entries: [
           { find: '../dist/thorvg.js', replacement: path.join('..', presetMap[preset].path, 'thorvg')  },
+          // single-threaded module for the pages can't use the multi-threaded one
+          { find: 'thorvg-fallback', replacement: path.join('..', presetMap[preset].fallback || presetMap[preset].path, 'thorvg')  },
         ]
       }),
       replace({
@@ -123,6 +137,7 @@ const createLottieConfig = (preset) => {
           '/dist': presetMap[preset].path,
           '__THORVG_VERSION__': process.env.THORVG_VERSION,
           '__RENDERER__': presetMap[preset].renderer,
+          '__THREADED__': String(!!presetMap[preset].fallback),
         },
       }),
       nodePolyfills(),
@@ -161,12 +176,30 @@ const createLottieConfig = (preset) => {
   };
 }
 
+// rendering worker of the player, loaded by the `worker` render config
+const createWorkerConfig = (preset) => {
+  const config = createLottieConfig(preset);
+  return {
+    ...config,
+    input: "./src/lottie-worker.ts",
+    output: [
+      {
+        file: `.${presetMap[preset].path}/lottie-worker.js`,
+        format: "esm",
+        ...commonOutput,
+      },
+    ],
+  };
+}
+
 export default [
   createLottieConfig(PresetModule.Default),
   createLottieConfig(PresetModule.SW),
   createLottieConfig(PresetModule.GL),
+  createLottieConfig(PresetModule.SW_MT),
   createLottieConfig(PresetModule.SW_LITE),
   createLottieConfig(PresetModule.GL_LITE),
+  ...Object.values(PresetModule).map(createWorkerConfig),
   {
     input: "./src/lottie-player.ts",
     treeshake: true,
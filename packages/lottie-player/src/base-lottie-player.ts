@@ -23,13 +23,17 @@
 import { html, PropertyValueMap, LitElement, type TemplateResult } from 'lit';
 import { property } from 'lit/decorators.js';
 
-import Module, { type MainModule, type TvgLottieAnimation } from '../dist/thorvg';
+import { type MainModule, type TvgLottieAnimation } from '../dist/thorvg';
+import { createModule, idleTime, loadBytes, mapPixels, warmup } from './thorvg-module';
+import { WorkerCommand, WorkerEvent, type WorkerRequest, type WorkerResponse } from './worker-protocol';
+import { getScheduler, type Task } from './scheduler';
 
 type LottieJson = Map<PropertyKey, any>;
 
 const THORVG_VERSION = '__THORVG_VERSION__';
 const DEFAULT_RENDERER = '__RENDERER__';
 const _wasmUrl = 'https://unpkg.com/@thorvg/lottie-player@latest/dist/thorvg.wasm';
+const _workerUrl = 'https://unpkg.com/@thorvg/lottie-player@latest/dist/lottie-worker.js';
 export let wasmModule: MainModule | null = null;
 let _moduleRequested: boolean = false;
 
@@ -57,6 +61,81 @@ export enum InitStatus {
 export type RenderConfig = {
   enableDevicePixelRatio?: boolean;
   renderer?: Renderer;
+  worker?: boolean; // render in a dedicated worker through OffscreenCanvas
+  frameCache?: FrameCacheConfig; // keep the rendered frames of the sw renderer for the next loops
+  stats?: boolean; // collect the frame timings and counters of getStats()
+  sharedContext?: boolean; // gl renderer: render in a single WebGL context shared by all the players
+  adaptive?: AdaptiveConfig; // lower the quality and the render resolution while the frames are slower than the target
+  scheduled?: boolean; // render along with the other scheduled players of the page, within a shared time budget per frame
+  memory?: MemoryConfig; // keep the memory of the player down
+  frameRate?: number; // cap the animation updates at this rate (fps), the display refreshes in between show the last frame
+  idle?: boolean; // sw renderer: learn the holds of the animation to skip their frames and sleep through the long ones
+}
+
+// Define the memory controls
+export type MemoryConfig = {
+  scratch?: number; // max bytes of the buffers kept for the reuse beyond the size in use
+  trimHidden?: boolean; // release the caches and the buffers while the player is off-screen, see trim()
+}
+
+// Define the memory held by a player, in bytes
+export type MemoryUsage = {
+  heap: number; // the whole wasm memory, shared by all the players
+  source: number; // the kept animation data (the parsed model isn't measured)
+  raster: number; // the render target
+  cache: number; // the cached frames
+  images: number;
+  fonts: number;
+  pool: number; // the idle buffers of the module kept for the next players
+}
+
+// Define the adaptive rendering
+export type AdaptiveConfig = {
+  frameTime: number; // target time (ms) of updating and rendering a frame
+}
+
+// Define the frame cache of the sw renderer
+// NOTE: the frame numbers are rounded to whole frames while the cache is on, the sub-frame tweens aren't shown
+export type FrameCacheConfig = {
+  budget: number; // in bytes
+  compress?: boolean; // run-length encode the cached frames
+}
+
+// Define the timings (min/avg/p95/max in milliseconds) of a rendering phase
+export type PhaseStats = {
+  min: number;
+  avg: number;
+  p95: number;
+  max: number;
+}
+
+// Define the rendering statistics
+export type RenderStats = {
+  frame: PhaseStats;
+  update: PhaseStats;
+  draw: PhaseStats;
+  sync: PhaseStats;
+  upload: PhaseStats;
+  frames: number;
+  paints: number;
+  bytes: number;
+  reallocs: number;
+}
+
+// Define a marker, a named frame range of the animation
+export type Marker = {
+  name: string;
+  begin: number;
+  end: number;
+}
+
+// Define the frame cache counters
+export type FrameCacheStats = {
+  budget: number;
+  used: number;
+  frames: number;
+  hits: number;
+  misses: number;
 }
 
 // Define file type which player can load
@@ -96,6 +175,7 @@ export enum PlayerEvent {
   Loop = 'loop',
   Pause = 'pause',
   Play = 'play',
+  Progress = 'progress',
   Ready = 'ready',
   Stop = 'stop',
 }
@@ -123,6 +203,20 @@ const _parseImageFromURL = async (url: string): Promise<ArrayBuffer> => {
   return response.arrayBuffer();
 }
 
+// URL to a lottie file, which can be streamed into the module while it's downloaded
+const _isStreamable = (src: string | object, fileType: FileType): src is string => {
+  if (typeof src !== 'string' || (fileType !== FileType.JSON && fileType !== FileType.LOT)) {
+    return false;
+  }
+
+  const data = src.trimStart();
+  return !data.startsWith('{') && !data.startsWith('[') && typeof ReadableStream !== 'undefined';
+}
+
+const _cancelled = (): Error => new DOMException('The load is cancelled', 'AbortError');
+
+const _isCancelled = (err: unknown): boolean => (err as Error)?.name === 'AbortError';
+
 const _parseJSON = async (data: string): Promise<string> => {
   try {
     data = JSON.parse(data);
@@ -189,6 +283,8 @@ const _initModule = async (engine: Renderer) => {
     switch (res) {
       case 0:
         _initStatus = InitStatus.INITIALIZED;
+        // the players added later on skip the pipeline compilation
+        warmup(wasmModule);
         return;
       case 1:
         _initStatus = InitStatus.FAILED;
@@ -220,6 +316,13 @@ export class BaseLottiePlayer extends LitElement {
   @property({ type: String })
   public wasmUrl?: string;
 
+  /**
+   * Custom URL for the rendering worker script, used with the `worker` render config
+   * @since 1.0
+   */
+  @property({ type: String })
+  public workerUrl?: string;
+
   /**
   * File type.
   * @since 1.0
@@ -303,20 +406,158 @@ export class BaseLottiePlayer extends LitElement {
    */
   @property({ type: Float32Array })
   public get size(): Float32Array {
-    return Float32Array.from(this.TVG?.size() || [0, 0]);
+    return Float32Array.from(this.TVG?.size() || this._size);
   }
 
   protected TVG: TvgLottieAnimation | null = null;
   protected canvas?: HTMLCanvasElement;
   protected config?: RenderConfig;
   private _imageData?: ImageData;
+  private _generation: number = 0;
+  private _idleTimer?: ReturnType<typeof setTimeout>;
   private _beginTime: number = Date.now();
   private _counter: number = 1;
   private _timer?: ReturnType<typeof setInterval>;
   private _observer?: IntersectionObserver;
   private _observable: boolean = false;
+  private _visibleArea: number = 0;
+  private _task?: Task;
+  private _intermission: boolean = false;
+  private _worker?: Worker;
+  private _workerReady?: Promise<void>;
+  private _workerResolve?: () => void;
+  private _size: number[] = [0, 0];
+  private _markers: Marker[] = [];
+  private _loadId: number = 0;
+  private _loading?: { id: number, resolve: () => void, reject: (err: Error) => void };
+
+  private get _initialized(): boolean {
+    return !!this.TVG || !!this._worker;
+  }
+
+  private _post(request: WorkerRequest, transfer: Transferable[] = []): void {
+    this._worker?.postMessage(request, transfer);
+  }
+
+  private _postConfig(): void {
+    this._post({
+      type: WorkerCommand.Config,
+      config: {
+        speed: this.speed,
+        loop: this.loop,
+        count: this.count,
+        direction: this.direction,
+        mode: this.mode,
+        intermission: this.intermission,
+      },
+    });
+  }
+
+  private _onWorkerMessage(event: MessageEvent<WorkerResponse>): void {
+    const message = event.data;
+
+    switch (message.type) {
+      case WorkerEvent.Ready:
+        this._workerResolve?.();
+        break;
+      case WorkerEvent.Load:
+        // the worker is done with a load replaced in the meantime
+        if (message.id !== this._loadId) {
+          break;
+        }
+        this.totalFrame = message.totalFrame;
+        this._size = message.size;
+        this._markers = message.markers;
+        this.dispatchEvent(new CustomEvent(PlayerEvent.Load));
+        if (this.autoPlay) {
+          this.play();
+        }
+        this._loading?.resolve();
+        break;
+      case WorkerEvent.Segment:
+        this.totalFrame = message.totalFrame;
+        break;
+      case WorkerEvent.Frame:
+        this.currentFrame = message.frame;
+        this.dispatchEvent(new CustomEvent(PlayerEvent.Frame, {
+          detail: {
+            frame: this.currentFrame,
+          },
+        }));
+        break;
+      case WorkerEvent.Complete:
+        this.currentState = PlayerState.Stopped;
+        this.dispatchEvent(new CustomEvent(PlayerEvent.Complete));
+        break;
+      case WorkerEvent.Error:
+        // don't keep waiting for the worker failed to initialize
+        this._workerResolve?.();
+        this._loading?.reject(new Error(message.message));
+        this.currentState = PlayerState.Error;
+        this.dispatchEvent(new CustomEvent(PlayerEvent.Error, { detail: { message: message.message } }));
+        break;
+      default:
+    }
+  }
+
+  private _canvasSize(): [number, number] {
+    // the adaptive rendering shrinks the canvas, take the displayed size instead
+    if (!this.config?.enableDevicePixelRatio && !this.config?.adaptive) {
+      return [this.canvas!.width, this.canvas!.height];
+    }
+
+    const dpr = this.config?.enableDevicePixelRatio ? 1 + ((window.devicePixelRatio - 1) * 0.75) : 1;
+    const { width, height } = this.canvas!.getBoundingClientRect();
+    return [Math.floor(width * dpr), Math.floor(height * dpr)];
+  }
+
+  private async _initWorker(engine: Renderer): Promise<void> {
+    // module workers can't be created from another origin directly, import the script from a same-origin blob instead
+    const scriptUrl = new URL(this.workerUrl || _workerUrl, window.location.href).href;
+    const blob = new Blob([`import '${scriptUrl}';`], { type: 'text/javascript' });
+
+    this._worker = new Worker(URL.createObjectURL(blob), { type: 'module' });
+    this._worker.onmessage = this._onWorkerMessage.bind(this);
+    this._workerReady = new Promise((resolve) => {
+      this._workerResolve = resolve;
+    });
+
+    const offscreen = this.canvas!.transferControlToOffscreen();
+    this._post({
+      type: WorkerCommand.Init,
+      canvas: offscreen,
+      renderer: engine,
+      wasmUrl: new URL(this.wasmUrl || _wasmUrl, window.location.href).href,
+      frameCache: this.config?.frameCache,
+      adaptive: this.config?.adaptive,
+      frameRate: this.config?.frameRate,
+      idle: this.config?.idle,
+    }, [offscreen]);
+    this._postConfig();
+
+    await this._workerReady;
+  }
 
   private async _init(): Promise<void> {
+    if (this.config?.worker) {
+      if (!this._timer) {
+        //NOTE: Worker has been requested, but called this function again
+        await this._workerReady;
+        return;
+      }
+
+      clearInterval(this._timer);
+      this._timer = undefined;
+
+      await this._initWorker(this.config?.renderer || (DEFAULT_RENDERER as Renderer));
+
+      // NOTE: the load() being called initializes the player, it'd be replaced otherwise
+      if (this.src && !this._loadId) {
+        this.load(this.src, this.fileType);
+      }
+      return;
+    }
+
     // Ensure module is loaded only once
     if (_moduleRequested) {
       while (!wasmModule) {
@@ -326,14 +567,7 @@ export class BaseLottiePlayer extends LitElement {
 
     if (!wasmModule) {
       _moduleRequested = true;
-      wasmModule = await Module({
-        locateFile: (path: string, prefix: string) => {
-          if (path.endsWith('.wasm')) {
-            return this.wasmUrl || _wasmUrl;
-          }
-          return prefix + path;
-        }
-      });
+      wasmModule = await createModule(this.wasmUrl || _wasmUrl);
     }
 
     if (!this._timer) {
@@ -353,9 +587,38 @@ export class BaseLottiePlayer extends LitElement {
       return;
     }
 
-    this.TVG = new wasmModule.TvgLottieAnimation(engine, `#${this.canvas!.id}`);
+    // the players sharing a context render offscreen, show the frames of it on a bitmap canvas
+    const shared = engine === Renderer.GL && !!this.config?.sharedContext;
+    this.TVG = new wasmModule.TvgLottieAnimation(shared ? 'gl-shared' : engine, `#${this.canvas!.id}`);
+    this._generation = 0;
 
-    if (this.src) {
+    // the frame cache and the hold detection work on the sw pixels, the gpu builds don't have them
+    const sw = engine === Renderer.SW;
+    if (sw && this.config?.frameCache) {
+      this.TVG.cacheBudget(this.config.frameCache.budget, !!this.config.frameCache.compress);
+    }
+
+    if (this.config?.adaptive) {
+      this.TVG.adaptive(this.config.adaptive.frameTime);
+    }
+
+    if (this.config?.frameRate) {
+      this.TVG.frameRate(this.config.frameRate);
+    }
+
+    if (sw && this.config?.idle) {
+      this.TVG.detectHolds(true);
+    }
+
+    if (this.config?.memory?.scratch !== undefined) {
+      this.TVG.scratchLimit(this.config.memory.scratch);
+    }
+
+    if (this.config?.stats) {
+      this.TVG.enableStats(true);
+    }
+
+    if (this.src && !this._loadId) {
       this.load(this.src, this.fileType);
     }
   }
@@ -395,14 +658,20 @@ export class BaseLottiePlayer extends LitElement {
     const entry = entries[0];
     const target = entry.target as BaseLottiePlayer;
     target._observable = entry.isIntersecting;
+    target._visibleArea = entry.intersectionRect.width * entry.intersectionRect.height;
 
     if (entry.isIntersecting) {
       if (target.currentState === PlayerState.Frozen) {
         target.play();
       }
-    } else if (target.currentState === PlayerState.Playing) {
-      target.freeze();
-      target.dispatchEvent(new CustomEvent(PlayerEvent.Freeze));
+    } else {
+      if (target.currentState === PlayerState.Playing) {
+        target.freeze();
+        target.dispatchEvent(new CustomEvent(PlayerEvent.Freeze));
+      }
+      if (target.config?.memory?.trimHidden) {
+        target.trim();
+      }
     }
   }
 
@@ -413,7 +682,9 @@ export class BaseLottiePlayer extends LitElement {
     this.canvas.width = this.canvas.offsetWidth;
     this.canvas.height = this.canvas.offsetHeight;
 
-    this._observer = new IntersectionObserver(this._observerCallback);
+    // the scheduler follows the visible area of the players
+    const threshold = this.config?.scheduled ? [0, 0.25, 0.5, 0.75, 1] : 0;
+    this._observer = new IntersectionObserver(this._observerCallback, { threshold });
     this._observer.observe(this);
 
     if (!this.TVG) {
@@ -426,6 +697,15 @@ export class BaseLottiePlayer extends LitElement {
     }
   }
 
+  protected updated(changedProperties: PropertyValueMap<any> | Map<PropertyKey, unknown>): void {
+    super.updated(changedProperties);
+
+    const playback = ['speed', 'loop', 'count', 'direction', 'mode', 'intermission'];
+    if (this._worker && playback.some((name) => changedProperties.has(name))) {
+      this._postConfig();
+    }
+  }
+
   protected createRenderRoot(): HTMLElement | DocumentFragment {
     this.style.display = 'block';
     return this;
@@ -438,20 +718,152 @@ export class BaseLottiePlayer extends LitElement {
 
     if (await this._update()) {
       this._render();
+
+      // sleep through a long hold instead of rendering the same frame every display refresh
+      const idle = idleTime(this.TVG, this.currentFrame, this.totalFrame, this.direction, this.speed);
+      if (idle > 0) {
+        this._idleTimer = setTimeout(() => window.requestAnimationFrame(this._animLoop.bind(this)), idle);
+        return;
+      }
+
       window.requestAnimationFrame(this._animLoop.bind(this));
     }
   }
 
-  private _loadBytes(data: Uint8Array): void {
+  private _loadBytes(data: Uint8Array, id: number): void {
+    if (this._worker) {
+      const [width, height] = this._canvasSize();
+      this._post({ type: WorkerCommand.Load, id, data, fileType: this.fileType, width, height });
+      return;
+    }
+
     if (!this.TVG) {
       throw new Error(`TVG is not initialized`);
     }
 
-    const isLoaded = this.TVG.load(data, this.fileType, this.canvas!.width, this.canvas!.height);
+    const isLoaded = loadBytes(wasmModule!, this.TVG, data, this.fileType, this.canvas!.width, this.canvas!.height);
     if (!isLoaded) {
       throw new Error(`Unable to load an image. Error: ${this.TVG.error()}`);
     }
+  }
+
+  // a load replaced by a newer one or aborted by its signal stops at the next step
+  private _checkLoad(id: number, signal?: AbortSignal): void {
+    if (id !== this._loadId || signal?.aborted) {
+      throw _cancelled();
+    }
+  }
+
+  // a new load supersedes the one in progress
+  private _nextLoad(): number {
+    this._loading?.reject(_cancelled());
+    this._loading = undefined;
+    return ++this._loadId;
+  }
+
+  // read the response chunks as they arrive, reporting the progress
+  private async _readStream(url: string, id: number, signal: AbortSignal | undefined, begin: (size: number) => void, append: (chunk: Uint8Array) => void): Promise<void> {
+    const response = await fetch(new URL(url, window.location.href).toString(), { signal });
+    if (!response.ok || !response.body) {
+      throw new Error(`An error occurred while trying to load the Lottie file from URL`);
+    }
+    this._checkLoad(id, signal);
+
+    // NOTE: it's the encoded size with a compressed response, only a hint to pre-size the buffer
+    const size = Number(response.headers.get('Content-Length')) || 0;
+    begin(size);
+
+    const reader = response.body.getReader();
+    let loaded = 0;
+    try {
+      while (true) {
+        const { done, value } = await reader.read();
+        this._checkLoad(id, signal);
+        if (done) {
+          break;
+        }
+
+        append(value);
+        loaded += value.byteLength;
+        this.dispatchEvent(new CustomEvent(PlayerEvent.Progress, { detail: { loaded, total: Math.max(size, loaded) } }));
+      }
+    } catch (err) {
+      reader.cancel().catch(() => {});
+      throw err;
+    }
+  }
+
+  // gather the response chunks in the module as they arrive, instead of waiting for the whole file
+  private async _loadStream(url: string, id: number, signal?: AbortSignal): Promise<void> {
+    try {
+      await this._readStream(url, id, signal, (size) => {
+        if (!this.TVG!.beginLoad(this.fileType, size)) {
+          throw new Error(`Unable to load an image. Error: ${this.TVG!.error()}`);
+        }
+      }, (chunk) => {
+        const ptr = this.TVG!.appendChunk(chunk.byteLength);
+        if (!ptr) {
+          throw new Error(`Unable to load an image. Error: ${this.TVG!.error()}`);
+        }
+        // NOTE: appendChunk() may grow the memory, access HEAPU8 after it
+        wasmModule!.HEAPU8.set(chunk, ptr);
+      });
+    } catch (err) {
+      // NOTE: the chunks in the module may belong to the newer load already
+      if (id === this._loadId) {
+        this.TVG?.cancelLoad();
+      }
+      throw err;
+    }
+
+    this.dispatchEvent(new CustomEvent(PlayerEvent.Ready));
 
+    if (!this.TVG!.endLoad(this.canvas!.width, this.canvas!.height)) {
+      throw new Error(`Unable to load an image. Error: ${this.TVG!.error()}`);
+    }
+  }
+
+  // the worker gets the whole data at once, gather the chunks here meanwhile
+  private async _fetchStream(url: string, id: number, signal?: AbortSignal): Promise<Uint8Array> {
+    const chunks: Uint8Array[] = [];
+    let length = 0;
+    await this._readStream(url, id, signal, () => {}, (chunk) => {
+      chunks.push(chunk);
+      length += chunk.byteLength;
+    });
+
+    const data = new Uint8Array(length);
+    let offset = 0;
+    for (const chunk of chunks) {
+      data.set(chunk, offset);
+      offset += chunk.byteLength;
+    }
+    return data;
+  }
+
+  // hand the data over to the module, or to the worker which renders the first frame by itself
+  private async _open(src: string | object, fileType: FileType, id: number, signal?: AbortSignal): Promise<void> {
+    if (_isStreamable(src, fileType)) {
+      this.fileType = fileType;
+      if (this.TVG) {
+        await this._loadStream(src, id, signal);
+        return;
+      }
+      const bytes = await this._fetchStream(src, id, signal);
+      this.dispatchEvent(new CustomEvent(PlayerEvent.Ready));
+      this._loadBytes(bytes, id);
+      return;
+    }
+
+    const bytes = await parseSrc(src, fileType);
+    this._checkLoad(id, signal);
+    this.dispatchEvent(new CustomEvent(PlayerEvent.Ready));
+
+    this.fileType = fileType;
+    this._loadBytes(bytes, id);
+  }
+
+  private _loaded(): void {
     this._render();
     this.dispatchEvent(new CustomEvent(PlayerEvent.Load));
     
@@ -460,9 +872,21 @@ export class BaseLottiePlayer extends LitElement {
     }
   }
 
-  private _flush(): void {
+  // top: the canvas row of the first image row
+  private _flush(top: number, x: number, y: number, width: number, height: number): void {
     const context = this.canvas!.getContext('2d');
-    context!.putImageData(this._imageData!, 0, 0);
+    context!.putImageData(this._imageData!, 0, top, x, y - top, width, height);
+  }
+
+  private _resizeCanvas(width: number, height: number): void {
+    // NOTE: assigning the canvas size clears its bitmap, even if the size is the same
+    if (this.canvas!.width !== Math.floor(width)) {
+      this.canvas!.width = width;
+    }
+
+    if (this.canvas!.height !== Math.floor(height)) {
+      this.canvas!.height = height;
+    }
   }
 
   private _render(): void {
@@ -470,47 +894,87 @@ export class BaseLottiePlayer extends LitElement {
       return;
     }
 
-    if (this.config?.enableDevicePixelRatio) {
-      const dpr = 1 + ((window.devicePixelRatio - 1) * 0.75);
-      const { width, height } = this.canvas!.getBoundingClientRect();
-      this.canvas!.width = width * dpr;
-      this.canvas!.height = height * dpr;
-    }
-
-    this.TVG.resize(this.canvas!.width, this.canvas!.height);
-    this._viewport();
+    this._prepare();
     const isUpdated = this.TVG.update();
 
     if (!isUpdated) {
       return;
     }
 
+    this.TVG.render();
+    this._present();
+  }
+
+  // size the canvas and the viewport before rendering
+  private _prepare(): void {
+    const [canvasWidth, canvasHeight] = this._canvasSize();
+    this.TVG!.resize(canvasWidth, canvasHeight);
+
+    // the canvas takes the render resolution, the css size of it scales the frames up to the display
+    if (this.config?.enableDevicePixelRatio || this.config?.adaptive) {
+      const [width, height] = this.TVG!.resolution();
+      this._resizeCanvas(width, height);
+    }
+
+    this._viewport();
+  }
+
+  // show the rendered frame on the canvas
+  private _present(): void {
     // webgpu & webgl
     if (this.config?.renderer === Renderer.WG || this.config?.renderer === Renderer.GL) {
-      this.TVG.render();
+      if (this.config?.sharedContext && this.config.renderer === Renderer.GL) {
+        // the bitmap is of the shared canvas size, the frame is the top-left area of it
+        const bitmap = this.TVG!.bitmap();
+        if (bitmap) {
+          const [width, height] = this.TVG!.resolution();
+          const context = this.canvas!.getContext('2d')!;
+          context.clearRect(0, 0, width, height);
+          context.drawImage(bitmap, 0, 0, width, height, 0, 0, width, height);
+          bitmap.close();
+        }
+      }
       return;
     }
 
-    const buffer = this.TVG.render();
-    const clampedBuffer = new Uint8ClampedArray(buffer, 0, buffer.byteLength);
-    if (clampedBuffer.length < 1) {
+    const generation = this.TVG!.generation();
+    if (generation === this._generation) {
       return;
     }
+    this._generation = generation;
 
-    this._imageData = new ImageData(clampedBuffer, this.canvas!.width, this.canvas!.height);
-    this._flush();
-  }
+    // upload the changed area only
+    const [x, y, width, height] = this.TVG!.damage();
+    if (width < 1 || height < 1) {
+      return;
+    }
 
-  private async _update(): Promise<boolean> {
-    if (!this.TVG) {
-      return false;
+    const begin = this.config?.stats ? performance.now() : 0;
+
+    // keep a single image over the wasm memory as long as the buffer stays
+    const image = mapPixels(wasmModule!, this.TVG!, this.canvas!.width, this.canvas!.height, this._imageData);
+    if (image) {
+      this._imageData = image;
+      this._flush(0, x, y, width, height);
+    } else {
+      const buffer = this.TVG!.region();
+      const clampedBuffer = new Uint8ClampedArray(buffer, 0, buffer.byteLength);
+      if (clampedBuffer.length < 1) {
+        return;
+      }
+
+      this._imageData = new ImageData(clampedBuffer, this.canvas!.width, height);
+      this._flush(y, x, y, width, height);
     }
 
-    if (this.currentState !== PlayerState.Playing) {
-      return false;
+    if (this.config?.stats) {
+      this.TVG!.recordUpload(performance.now() - begin);
     }
+  }
 
-    const duration = this.TVG.duration();
+  // move the current frame on with the time, returns 'loop' when a loop is over and it's played again
+  private _advance(): boolean | 'loop' {
+    const duration = this.TVG!.duration();
     const currentTime = Date.now() / 1000;
     this.currentFrame = (currentTime - this._beginTime) / duration * this.totalFrame * this.speed;
     if (this.direction === -1) {
@@ -532,9 +996,7 @@ export class BaseLottiePlayer extends LitElement {
           this._counter += 1;
         }
 
-        await _wait(this.intermission);
-        this.play();
-        return true;
+        return 'loop';
       }
 
       this.dispatchEvent(new CustomEvent(PlayerEvent.Complete));
@@ -546,9 +1008,63 @@ export class BaseLottiePlayer extends LitElement {
         frame: this.currentFrame,
       },
     }));
+    return true;
+  }
+
+  private async _update(): Promise<boolean> {
+    if (!this.TVG) {
+      return false;
+    }
+
+    if (this.currentState !== PlayerState.Playing) {
+      return false;
+    }
+
+    if (this._advance() === 'loop') {
+      await _wait(this.intermission);
+      this.play();
+      return true;
+    }
+
     return this.TVG.frame(this.currentFrame);
   }
 
+  // render from the scheduler shared by the players of the page, instead of an animation frame loop of its own
+  private _schedule(): void {
+    if (!this._task) {
+      const task: Task = {
+        handle: this.TVG!.handle(),
+        priority: () => (this._observable ? this._visibleArea : 0),
+        advance: () => {
+          if (!this.TVG || this.currentState !== PlayerState.Playing) {
+            getScheduler(wasmModule!).remove(task);
+            return;
+          }
+          if (this._intermission) {
+            return;
+          }
+          if (this._advance() === 'loop') {
+            this._intermission = true;
+            setTimeout(() => {
+              this._intermission = false;
+              this.play();
+            }, this.intermission);
+            return;
+          }
+          return this.currentFrame;
+        },
+        prepare: () => this._prepare(),
+        present: () => {
+          this._present();
+          return idleTime(this.TVG!, this.currentFrame, this.totalFrame, this.direction, this.speed);
+        },
+      };
+      this._task = task;
+    }
+
+    getScheduler(wasmModule!).add(this._task);
+  }
+
   private _frame(curFrame: number): void {
     if (!this.TVG) {
       return;
@@ -566,25 +1082,86 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public async load(src: string | object, fileType: FileType = FileType.JSON): Promise<void> {
+    const id = this._nextLoad();
     try {
       await this._init();
-      const bytes = await parseSrc(src, fileType);
-      this.dispatchEvent(new CustomEvent(PlayerEvent.Ready));
+      this._checkLoad(id);
 
-      this.fileType = fileType;
-      await this._loadBytes(bytes);
+      await this._open(src, fileType, id);
+      if (!this._worker) {
+        this._loaded();
+      }
     } catch (err) {
+      // replaced by a newer load, not a failure
+      if (_isCancelled(err)) {
+        return;
+      }
       this.currentState = PlayerState.Error;
       this.dispatchEvent(new CustomEvent(PlayerEvent.Error));
     }
   }
 
+  /**
+   * Load without blocking the page, i.e. while scrolling a list of players.
+   * The download reports its progress with the `progress` events. The parsing runs in the worker with the `worker` render config,
+   * or on the task scheduler of the multi-threaded preset while the page goes on for a frame.
+   * NOTE: Otherwise (the single-threaded presets on the main thread), the parsing still blocks the main thread as load() does,
+   * only the download and the handover are asynchronous. Use the `worker` render config for the large animations.
+   * A newer `load()`/`loadAsync()` or the given signal cancels it, i.e. when a virtualized list recycles the player.
+   * @param src Lottie animation JSON data or URL to JSON.
+   * @param fileType The file type of the data to be loaded, defaults to JSON
+   * @param signal Aborts the load
+   * @returns Resolves when the first frame is rendered, rejects with an `AbortError` when it's cancelled
+   * @since 1.0
+   */
+  public async loadAsync(src: string | object, fileType: FileType = FileType.JSON, signal?: AbortSignal): Promise<void> {
+    const id = this._nextLoad();
+    const abort = () => {
+      this._post({ type: WorkerCommand.Cancel, id });
+      if (this._loading?.id === id) {
+        this._loading.reject(_cancelled());
+        this._loading = undefined;
+      }
+    };
+    signal?.addEventListener('abort', abort, { once: true });
+
+    try {
+      await this._init();
+      this._checkLoad(id, signal);
+
+      await this._open(src, fileType, id, signal);
+      if (this._worker) {
+        // NOTE: the worker responds in a later task, after this continuation
+        await new Promise<void>((resolve, reject) => {
+          this._loading = { id, resolve, reject };
+        });
+        return;
+      }
+
+      // the multi-threaded loader keeps parsing on the task scheduler until the first update(), let the page go on meanwhile
+      await new Promise((resolve) => window.requestAnimationFrame(resolve));
+      this._checkLoad(id, signal);
+      this._loaded();
+    } catch (err) {
+      if (!_isCancelled(err)) {
+        this.currentState = PlayerState.Error;
+        this.dispatchEvent(new CustomEvent(PlayerEvent.Error));
+      }
+      throw err;
+    } finally {
+      signal?.removeEventListener('abort', abort);
+      if (this._loading?.id === id) {
+        this._loading = undefined;
+      }
+    }
+  }
+
   /**
    * Start playing animation.
    * @since 1.0
    */
   public play(): void {
-    if (!this.TVG) {
+    if (!this._initialized) {
       return;
     }
 
@@ -592,18 +1169,28 @@ export class BaseLottiePlayer extends LitElement {
       return;
     }
 
-    this.totalFrame = this.TVG.totalFrame();
+    this.totalFrame = this.TVG ? this.TVG.totalFrame() : this.totalFrame;
     if (this.totalFrame < 1) {
       return;
     }
 
     this._beginTime = Date.now() / 1000;
     if (this.currentState === PlayerState.Playing) {
+      this._post({ type: WorkerCommand.Play });
       return;
     }
 
     if (this._observable) {
       this.currentState = PlayerState.Playing;
+      if (this._worker) {
+        this._post({ type: WorkerCommand.Play });
+        return;
+      }
+      if (this.config?.scheduled && this.TVG) {
+        this._schedule();
+        return;
+      }
+      clearTimeout(this._idleTimer);
       window.requestAnimationFrame(this._animLoop.bind(this));
       return;
     }
@@ -616,6 +1203,7 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public pause(): void {
+    this._post({ type: WorkerCommand.Pause });
     this.currentState = PlayerState.Paused;
     this.dispatchEvent(new CustomEvent(PlayerEvent.Pause));
   }
@@ -628,7 +1216,12 @@ export class BaseLottiePlayer extends LitElement {
     this.currentState = PlayerState.Stopped;
     this.currentFrame = 0;
     this._counter = 1;
-    this.seek(0);
+
+    if (this._worker) {
+      this._post({ type: WorkerCommand.Stop });
+    } else {
+      this.seek(0);
+    }
 
     this.dispatchEvent(new CustomEvent(PlayerEvent.Stop));
   }
@@ -638,6 +1231,7 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public freeze(): void {
+    this._post({ type: WorkerCommand.Pause });
     this.currentState = PlayerState.Frozen;
     this.dispatchEvent(new CustomEvent(PlayerEvent.Freeze));
   }
@@ -648,6 +1242,13 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public async seek(frame: number): Promise<void> {
+    if (this._worker) {
+      this.pause();
+      this.currentFrame = frame;
+      this._post({ type: WorkerCommand.Seek, frame });
+      return;
+    }
+
     this._frame(frame);
     await this._update();
     this._render();
@@ -660,8 +1261,13 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public resize(width: number, height: number) {
-    this.canvas!.width = width;
-    this.canvas!.height = height;
+    if (this._worker) {
+      //NOTE: the canvas size is owned by the worker after transferring its control
+      this._post({ type: WorkerCommand.Resize, width, height });
+      return;
+    }
+
+    this._resizeCanvas(width, height);
 
     if (this.currentState !== PlayerState.Playing) {
       this._render();
@@ -673,12 +1279,21 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public destroy(): void {
-    if (!this.TVG) {
+    if (!this._initialized) {
       return;
     }
 
-    this.TVG.delete();
-    this.TVG = null;
+    if (this._worker) {
+      this._post({ type: WorkerCommand.Destroy });
+      this._worker = undefined;
+    } else {
+      if (this._task) {
+        getScheduler(wasmModule!).remove(this._task);
+        this._task = undefined;
+      }
+      this.TVG!.delete();
+      this.TVG = null;
+    }
     this.currentState = PlayerState.Destroyed;
 
     if (this._observer) {
@@ -690,6 +1305,24 @@ export class BaseLottiePlayer extends LitElement {
     this.remove();
   }
 
+  /**
+   * Compile the render pipelines of the WebGPU renderer ahead of time. It's done in the idle time once the WebGPU device
+   * is acquired anyway, call it to wait for it (i.e. before adding the players in the middle of the session).
+   * @since 1.0
+   */
+  public async warmup(): Promise<boolean> {
+    if (!wasmModule || this.config?.renderer !== Renderer.WG) {
+      return false;
+    }
+
+    await _initModule(Renderer.WG);
+    if (_initStatus !== InitStatus.INITIALIZED) {
+      return false;
+    }
+
+    return warmup(wasmModule);
+  }
+
   /**
    * Terminate module and release resources
    * @since 1.0
@@ -709,7 +1342,7 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public setLooping(value: boolean): void {
-    if (!this.TVG) {
+    if (!this._initialized) {
       return;
     }
 
@@ -722,7 +1355,7 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public setDirection(value: number): void {
-    if (!this.TVG) {
+    if (!this._initialized) {
       return;
     }
 
@@ -735,7 +1368,7 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public setSpeed(value: number): void {
-    if (!this.TVG) {
+    if (!this._initialized) {
       return;
     }
 
@@ -748,7 +1381,7 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public setBgColor(value: string): void {
-    if (!this.TVG) {
+    if (!this._initialized) {
       return;
     }
 
@@ -761,6 +1394,11 @@ export class BaseLottiePlayer extends LitElement {
    * @since 1.0
    */
   public setQuality(value: number): void {
+    if (this._worker) {
+      this._post({ type: WorkerCommand.Quality, value });
+      return;
+    }
+
     if (!this.TVG) {
       return;
     }
@@ -770,6 +1408,113 @@ export class BaseLottiePlayer extends LitElement {
     }
   }
 
+  /**
+   * Returns the markers of the loaded animation, the named frame ranges to play with `setSegment()`.
+   * @since 1.0
+   */
+  public getMarkers(): Marker[] {
+    if (!this.TVG) {
+      return this._markers;
+    }
+
+    return this.TVG.markers() as Marker[];
+  }
+
+  /**
+   * Plays the frames of the marker only, or the frames [begin, end] of the animation.
+   * An empty marker name selects the whole animation again. The frame numbers (`currentFrame`, `totalFrame` and `seek()`)
+   * are relative to the segment then.
+   * @param marker The marker name, see `getMarkers()`
+   * @since 1.0
+   */
+  public setSegment(marker: string): void;
+  /**
+   * @param begin The first frame of the segment
+   * @param end The last frame of the segment
+   */
+  public setSegment(begin: number, end: number): void;
+  public setSegment(markerOrBegin: string | number, end?: number): void {
+    const marker = typeof markerOrBegin === 'string' ? markerOrBegin : undefined;
+    const begin = typeof markerOrBegin === 'number' ? markerOrBegin : undefined;
+
+    if (this._worker) {
+      this._post({ type: WorkerCommand.Segment, marker, begin, end });
+      return;
+    }
+
+    if (!this.TVG) {
+      return;
+    }
+
+    const selected = marker !== undefined ? this.TVG.marker(marker) : this.TVG.segment(begin!, end ?? this.totalFrame);
+    if (!selected) {
+      this.dispatchEvent(new CustomEvent(PlayerEvent.Error, { detail: { message: this.TVG.error() } }));
+      return;
+    }
+
+    this.totalFrame = this.TVG.totalFrame();
+    this.currentFrame = this.direction === 1 ? 0 : this.totalFrame;
+    this._beginTime = Date.now() / 1000;
+    this.TVG.frame(this.currentFrame);
+
+    if (this.currentState !== PlayerState.Playing) {
+      this._render();
+    }
+  }
+
+  /**
+   * Returns the frame cache counters, undefined while it's rendering in a worker, with a GPU renderer or not initialized.
+   * @since 1.0
+   */
+  public getFrameCacheStats(): FrameCacheStats | undefined {
+    if (!this.TVG || (this.config?.renderer || DEFAULT_RENDERER) !== Renderer.SW) {
+      return;
+    }
+
+    const [budget, used, frames, hits, misses] = this.TVG.cacheStats();
+    return { budget, used, frames, hits, misses };
+  }
+
+  /**
+   * Returns the frame timings and the rendering counters collected with the `stats` render config.
+   * The phase timings are min/avg/p95/max in milliseconds over the recent 120 frames.
+   * Undefined while it's rendering in a worker or not initialized.
+   * @since 1.0
+   */
+  public getStats(): RenderStats | undefined {
+    if (!this.TVG || !this.config?.stats) {
+      return;
+    }
+
+    return this.TVG.stats() as RenderStats;
+  }
+
+  /**
+   * Returns the memory the player holds, in bytes. Undefined while it's rendering in a worker or not initialized.
+   * @since 1.0
+   */
+  public getMemoryUsage(): MemoryUsage | undefined {
+    if (!this.TVG) {
+      return;
+    }
+
+    return this.TVG.memoryUsage() as MemoryUsage;
+  }
+
+  /**
+   * Release the cached frames and the buffers of the player that can be made again, i.e. while it's off-screen.
+   * They're taken again on the next frame. The freed memory is reused by the other players, the wasm memory itself doesn't shrink.
+   * @since 1.0
+   */
+  public trim(): void {
+    if (!this.TVG || !wasmModule) {
+      return;
+    }
+
+    this.TVG.trim();
+    wasmModule.trim();
+  }
+
   /**
    * Return thorvg version
    * @since 1.0
@@ -32,6 +32,16 @@ const _downloadFile = (fileName: string, blob: Blob) => {
   document.body.removeChild(link);
 }
 
+// Define the frames to export
+export type ExportOptions = {
+  begin?: number; // the first frame, 0 by default
+  end?: number; // the frame to stop before, the end of the animation (segment) by default
+  stride?: number; // frames to advance per exported frame, 1 by default
+  width: number;
+  height: number;
+  format?: 'png' | 'rgba'; // 'rgba' returns the raw straight alpha pixels
+}
+
 @customElement('lottie-player')
 export class LottiePlayer extends BaseLottiePlayer {
   /**
@@ -99,4 +109,29 @@ export class LottiePlayer extends BaseLottiePlayer {
     _downloadFile('output.gif', blob);
     saver.delete();
   }
+
+  /**
+   * Render the frames of the animation at the given size and encode each of them in memory.
+   * It renders with a software canvas of its own, the playback isn't affected.
+   * @param options The frame range, size and format to export
+   * @since 1.0
+   */
+  public exportFrames(options: ExportOptions): ArrayBuffer[] {
+    if (!this.TVG) {
+      throw new Error(`Unable to export. The animation is not loaded in this thread.`);
+    }
+
+    // the lite presets are built without it
+    if (!this.TVG.exportFrames) {
+      throw new Error(`Unable to export. The preset doesn't support exporting frames.`);
+    }
+
+    const { begin = 0, end = 0, stride = 1, width, height, format = 'png' } = options;
+    const frames = this.TVG.exportFrames(begin, end, stride, width, height, format) as ArrayBuffer[];
+    if (frames.length === 0) {
+      throw new Error(`Unable to export. Error: ${this.TVG.error()}`);
+    }
+
+    return frames;
+  }
 }
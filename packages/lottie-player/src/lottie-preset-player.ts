@@ -34,8 +34,8 @@ export class LottiePresetPlayer extends BaseLottiePlayer {
   @property({ type: Object })
   public set renderConfig(value: PresetRenderConfig) {
     this.config = {
+      ...value,
       renderer: '__RENDERER__' as Renderer,
-      enableDevicePixelRatio: value.enableDevicePixelRatio
     };
   }
 
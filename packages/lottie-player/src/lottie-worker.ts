@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2023 - 2025 the ThorVG project. All rights reserved.
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Rendering worker of the player. It owns the ThorVG module and the animation, and draws to the transferred OffscreenCanvas
+// so that the animation playback and the main thread don't stall each other.
+
+import { type MainModule, type TvgLottieAnimation } from '../dist/thorvg';
+import { createModule, idleTime, loadBytes, mapPixels } from './thorvg-module';
+import {
+  WorkerCommand,
+  WorkerEvent,
+  type PlaybackConfig,
+  type WorkerRequest,
+  type WorkerResponse,
+} from './worker-protocol';
+
+// the GL/WG engines find the transferred canvas by this selector
+const SELECTOR = '#thorvg-offscreen';
+
+type WorkerScope = {
+  postMessage(message: WorkerResponse): void;
+  requestAnimationFrame?: (callback: () => void) => number;
+  close(): void;
+  onmessage: ((event: MessageEvent<WorkerRequest>) => void) | null;
+};
+
+const scope = self as unknown as WorkerScope;
+
+let wasmModule: MainModule | null = null;
+let TVG: TvgLottieAnimation | null = null;
+let canvas: OffscreenCanvas | null = null;
+let canvasSize: [number, number] = [0, 0]; // the requested size, the canvas itself takes the render resolution
+let image: ImageData | undefined;
+let generation = 0;
+let idleTimer: ReturnType<typeof setTimeout> | undefined;
+let renderer: string = 'sw';
+let config: PlaybackConfig = { speed: 1, loop: false, direction: 1, mode: 'normal', intermission: 1 };
+let direction: number = 1;
+let totalFrame: number = 0;
+let currentFrame: number = 0;
+let beginTime: number = 0;
+let counter: number = 1;
+let playing: boolean = false;
+let latestLoad: number = 0; // the id of the last load received, the ones queued before it are superseded
+let cancelled: number = 0;
+
+const _post = (message: WorkerResponse) => {
+  scope.postMessage(message);
+}
+
+const _error = (message: string) => {
+  _post({ type: WorkerEvent.Error, message });
+}
+
+const _wait = (timeToDelay: number) => {
+  return new Promise((resolve) => setTimeout(resolve, timeToDelay))
+};
+
+const _nextFrame = (callback: () => void) => {
+  // NOTE: requestAnimationFrame is available in the dedicated workers of the browsers supporting OffscreenCanvas, but not all of them
+  if (scope.requestAnimationFrame) {
+    scope.requestAnimationFrame(callback);
+    return;
+  }
+  setTimeout(callback, 1000 / 60);
+}
+
+const _init = async (wasmUrl: string) => {
+  wasmModule = await createModule(wasmUrl);
+
+  if (renderer === 'wg') {
+    while (true) {
+      const res = wasmModule.init();
+      if (res === 1) {
+        _error('WebGPU initialization failed');
+        return;
+      }
+      if (res === 0) {
+        break;
+      }
+      await _wait(100);
+    }
+  }
+
+  if (renderer !== 'sw') {
+    wasmModule.offscreen(SELECTOR, canvas);
+  }
+
+  TVG = new wasmModule.TvgLottieAnimation(renderer, SELECTOR);
+  if (TVG.error() !== 'None') {
+    _error(TVG.error());
+    return;
+  }
+
+  _post({ type: WorkerEvent.Ready });
+}
+
+const _render = () => {
+  if (!TVG || !canvas) {
+    return;
+  }
+
+  TVG.resize(canvasSize[0], canvasSize[1]);
+
+  const [renderWidth, renderHeight] = TVG.resolution();
+  if (canvas.width !== renderWidth || canvas.height !== renderHeight) {
+    canvas.width = renderWidth;
+    canvas.height = renderHeight;
+  }
+
+  if (!TVG.update()) {
+    return;
+  }
+
+  // webgpu & webgl
+  if (renderer !== 'sw') {
+    TVG.render();
+    return;
+  }
+
+  TVG.render();
+
+  if (TVG.generation() === generation) {
+    return;
+  }
+  generation = TVG.generation();
+
+  // upload the changed area only
+  const [x, y, width, height] = TVG.damage();
+  if (width < 1 || height < 1) {
+    return;
+  }
+
+  const context = canvas.getContext('2d') as OffscreenCanvasRenderingContext2D;
+
+  // keep a single image over the wasm memory as long as the buffer stays
+  image = mapPixels(wasmModule!, TVG, canvas.width, canvas.height, image);
+  if (image) {
+    context.putImageData(image, 0, 0, x, y, width, height);
+    return;
+  }
+
+  const buffer = TVG.region();
+  const clampedBuffer = new Uint8ClampedArray(buffer, 0, buffer.byteLength);
+  if (clampedBuffer.length < 1) {
+    return;
+  }
+
+  context.putImageData(new ImageData(clampedBuffer, canvas.width, height), 0, y, x, 0, width, height);
+}
+
+const _update = async (): Promise<boolean> => {
+  if (!TVG || !playing) {
+    return false;
+  }
+
+  const duration = TVG.duration();
+  const currentTime = Date.now() / 1000;
+  currentFrame = (currentTime - beginTime) / duration * totalFrame * config.speed;
+  if (direction === -1) {
+    currentFrame = totalFrame - currentFrame;
+  }
+
+  if (
+    (direction === 1 && currentFrame >= totalFrame) ||
+    (direction === -1 && currentFrame <= 0)
+  ) {
+    const totalCount = config.count ? config.mode === 'bounce' ? config.count * 2 : config.count : 0;
+    if (config.loop || (totalCount && counter < totalCount)) {
+      if (config.mode === 'bounce') {
+        direction = direction === 1 ? -1 : 1;
+        currentFrame = direction === 1 ? 0 : totalFrame;
+      }
+
+      if (config.count) {
+        counter += 1;
+      }
+
+      await _wait(config.intermission);
+      beginTime = Date.now() / 1000;
+      return true;
+    }
+
+    playing = false;
+    _post({ type: WorkerEvent.Complete });
+  }
+
+  _post({ type: WorkerEvent.Frame, frame: currentFrame });
+  return TVG.frame(currentFrame);
+}
+
+const _animLoop = async () => {
+  if (await _update()) {
+    _render();
+
+    // sleep through a long hold instead of rendering the same frame every display refresh
+    const idle = idleTime(TVG!, currentFrame, totalFrame, direction, config.speed);
+    if (idle > 0) {
+      idleTimer = setTimeout(() => _nextFrame(_animLoop), idle);
+      return;
+    }
+
+    _nextFrame(_animLoop);
+  }
+}
+
+const _play = () => {
+  if (!TVG) {
+    return;
+  }
+
+  totalFrame = TVG.totalFrame();
+  if (totalFrame < 1) {
+    return;
+  }
+
+  beginTime = Date.now() / 1000;
+  if (playing) {
+    return;
+  }
+
+  playing = true;
+  clearTimeout(idleTimer);
+  _nextFrame(_animLoop);
+}
+
+const _seek = (frame: number) => {
+  if (!TVG) {
+    return;
+  }
+
+  playing = false;
+  currentFrame = frame;
+  TVG.frame(frame);
+  _render();
+}
+
+const _handle = async (request: WorkerRequest) => {
+  switch (request.type) {
+    case WorkerCommand.Init:
+      canvas = request.canvas;
+      renderer = request.renderer;
+      await _init(request.wasmUrl);
+      if (TVG && renderer === 'sw' && request.frameCache) {
+        TVG.cacheBudget(request.frameCache.budget, !!request.frameCache.compress);
+      }
+      if (TVG && request.adaptive) {
+        TVG.adaptive(request.adaptive.frameTime);
+      }
+      if (TVG && request.frameRate) {
+        TVG.frameRate(request.frameRate);
+      }
+      if (TVG && renderer === 'sw' && request.idle) {
+        TVG.detectHolds(true);
+      }
+      break;
+    case WorkerCommand.Load: {
+      if (!TVG || !canvas) {
+        _error('TVG is not initialized');
+        return;
+      }
+      if (request.id !== latestLoad || request.id === cancelled) {
+        return;
+      }
+      canvas.width = request.width;
+      canvas.height = request.height;
+      canvasSize = [request.width, request.height];
+      if (!loadBytes(wasmModule!, TVG, request.data, request.fileType, request.width, request.height)) {
+        _error(`Unable to load an image. Error: ${TVG.error()}`);
+        return;
+      }
+      _render();
+      const size = TVG.size();
+      _post({ type: WorkerEvent.Load, id: request.id, totalFrame: TVG.totalFrame(), duration: TVG.duration(), size: [size[0], size[1]], markers: TVG.markers() });
+      break;
+    }
+    case WorkerCommand.Play:
+      _play();
+      break;
+    case WorkerCommand.Pause:
+      playing = false;
+      break;
+    case WorkerCommand.Stop:
+      counter = 1;
+      _seek(0);
+      break;
+    case WorkerCommand.Seek:
+      _seek(request.frame);
+      break;
+    case WorkerCommand.Resize:
+      if (!canvas) {
+        return;
+      }
+      canvasSize = [request.width, request.height];
+      if (!playing) {
+        _render();
+      }
+      break;
+    case WorkerCommand.Config:
+      config = request.config;
+      direction = config.direction;
+      break;
+    case WorkerCommand.Quality:
+      if (TVG && TVG.quality(request.value) && !playing) {
+        _render();
+      }
+      break;
+    case WorkerCommand.Segment: {
+      if (!TVG) {
+        return;
+      }
+      const selected = request.marker !== undefined ? TVG.marker(request.marker) : TVG.segment(request.begin!, request.end!);
+      if (!selected) {
+        _error(TVG.error());
+        return;
+      }
+      totalFrame = TVG.totalFrame();
+      beginTime = Date.now() / 1000;
+      currentFrame = direction === 1 ? 0 : totalFrame;
+      TVG.frame(currentFrame);
+      if (!playing) {
+        _render();
+      }
+      _post({ type: WorkerEvent.Segment, totalFrame, duration: TVG.duration() });
+      break;
+    }
+    case WorkerCommand.Destroy:
+      playing = false;
+      if (TVG) {
+        TVG.delete();
+        TVG = null;
+      }
+      scope.close();
+      break;
+    default:
+  }
+}
+
+// handle the requests in order, even if some of them are asynchronous
+let _pending: Promise<void> = Promise.resolve();
+scope.onmessage = (event: MessageEvent<WorkerRequest>) => {
+  // see the loads ahead of their turn, not to parse the data of a cancelled or replaced one in the queue
+  const request = event.data;
+  if (request.type === WorkerCommand.Load) {
+    latestLoad = request.id;
+  } else if (request.type === WorkerCommand.Cancel) {
+    cancelled = request.id;
+    return;
+  }
+  _pending = _pending.then(() => _handle(event.data)).catch((err) => _error(String(err)));
+};
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2023 - 2025 the ThorVG project. All rights reserved.
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Renders all the scheduled players of the page from a single animation frame loop, within a time budget per tick.
+// The players on screen and large come first, the smaller ones are played at a lower rate and the ones not fitting
+// the budget wait for the next ticks. The animations of a tick are advanced and rendered in a single wasm call.
+
+import { type MainModule } from '../dist/thorvg';
+
+const FRAME_TIME = 1000 / 60;
+
+// A player of the scheduler
+export type Task = {
+  // TvgLottieAnimation.handle()
+  handle: number;
+  // displayed area of the player in pixels, 0 while it's not seen
+  priority: () => number;
+  // the frame number to render in this tick, undefined to skip it
+  advance: () => number | undefined;
+  // prepares the canvas before rendering, i.e. the size
+  prepare: () => void;
+  // shows the rendered frame and returns the time (ms) it can sleep for, i.e. through a hold
+  present: () => number;
+}
+
+type Entry = {
+  task: Task;
+  due: number;      // the time it's rendered again at the earliest
+  waited: number;   // ticks it has been due but didn't fit the budget
+}
+
+export class Scheduler {
+  // rendering time (ms) per tick, leave the rest of the display frame to the page
+  public budget: number = 8;
+
+  #module: MainModule;
+  #entries: Map<Task, Entry> = new Map();
+  #cost: number = 1;   // average time (ms) of an animation in the ticks
+  #running: boolean = false;
+
+  constructor(module: MainModule) {
+    this.#module = module;
+  }
+
+  public add(task: Task): void {
+    if (!this.#entries.has(task)) {
+      this.#entries.set(task, { task, due: 0, waited: 0 });
+    }
+
+    if (!this.#running) {
+      this.#running = true;
+      requestAnimationFrame(this.#tick);
+    }
+  }
+
+  public remove(task: Task): void {
+    this.#entries.delete(task);
+  }
+
+  #tick = (now: number): void => {
+    if (this.#entries.size === 0) {
+      this.#running = false;
+      return;
+    }
+    requestAnimationFrame(this.#tick);
+
+    const due: [Entry, number][] = [];
+    let largest = 0;
+    for (const entry of this.#entries.values()) {
+      const priority = entry.task.priority();
+      if (priority <= 0 || now < entry.due) {
+        continue;
+      }
+      due.push([entry, priority]);
+      largest = Math.max(largest, priority);
+    }
+    if (due.length === 0) {
+      return;
+    }
+
+    // the ones waiting longer move up, so that all of them get their turn
+    due.sort(([a, pa], [b, pb]) => pb * (1 + b.waited) - pa * (1 + a.waited));
+
+    const capacity = Math.max(1, Math.floor(this.budget / this.#cost));
+    const picked: [Entry, number][] = [];
+    const frames: number[] = [];
+
+    for (const [entry, priority] of due) {
+      if (picked.length >= capacity) {
+        entry.waited += 1;
+        continue;
+      }
+      const frame = entry.task.advance();
+      if (frame === undefined) {
+        continue;
+      }
+      entry.task.prepare();
+      picked.push([entry, priority]);
+      frames.push(frame);
+    }
+    if (picked.length === 0) {
+      return;
+    }
+
+    // NOTE: schedule() may grow the memory, access the heap after it
+    const TvgLottieAnimation = this.#module.TvgLottieAnimation;
+    const ptr = TvgLottieAnimation.schedule(picked.length);
+    const u32 = new Uint32Array(this.#module.HEAPU8.buffer, ptr, picked.length * 2);
+    const f32 = new Float32Array(this.#module.HEAPU8.buffer, ptr, picked.length * 2);
+    picked.forEach(([entry], i) => {
+      u32[i * 2] = entry.task.handle;
+      f32[i * 2 + 1] = frames[i];
+    });
+
+    const begin = performance.now();
+    TvgLottieAnimation.tick(picked.length);
+    this.#cost = this.#cost * 0.8 + (performance.now() - begin) / picked.length * 0.2;
+
+    for (const [entry, priority] of picked) {
+      const idle = entry.task.present();
+
+      // 60 fps for the large ones, 30 and 15 for the smaller ones
+      const ratio = priority / largest;
+      const interval = ratio >= 0.25 ? FRAME_TIME : ratio >= 0.05 ? FRAME_TIME * 2 : FRAME_TIME * 4;
+
+      // a little early, to be in time for the display frame
+      entry.due = now + Math.max(interval, idle) - 1;
+      entry.waited = 0;
+    }
+  };
+}
+
+let _scheduler: Scheduler | null = null;
+
+/**
+ * The scheduler shared by the players of the page
+ */
+export const getScheduler = (module: MainModule): Scheduler => {
+  if (!_scheduler) {
+    _scheduler = new Scheduler(module);
+  }
+  return _scheduler;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2023 - 2025 the ThorVG project. All rights reserved.
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+import Module, { type MainModule, type TvgLottieAnimation } from '../dist/thorvg';
+import FallbackModule from 'thorvg-fallback';
+
+const THREADED: string = '__THREADED__';
+
+// multi-threaded module requires SharedArrayBuffer, which is only available on the cross-origin isolated pages
+const _isThreadable = () => {
+  return typeof SharedArrayBuffer !== 'undefined' && globalThis.crossOriginIsolated === true;
+}
+
+/**
+ * Instantiate the ThorVG module with the given wasm
+ * @param wasmUrl URL to the wasm binary. The single-threaded fallback is looked up in the fallback/ next to it.
+ */
+export const createModule = async (wasmUrl: string): Promise<MainModule> => {
+  const baseUrl = new URL(wasmUrl, globalThis.location.href);
+  const fallback = THREADED === 'true' && !_isThreadable();
+
+  return (fallback ? FallbackModule : Module)({
+    locateFile: (path: string, prefix: string) => {
+      if (path.endsWith('.wasm')) {
+        return fallback ? new URL('fallback/thorvg.wasm', baseUrl).href : wasmUrl;
+      }
+      if (path.endsWith('.worker.js')) {
+        return new URL(path, baseUrl).href;
+      }
+      return prefix + path;
+    }
+  });
+}
+
+/**
+ * Compile the render pipelines of the wg engine while the browser is idle, ahead of the first frames of the players.
+ * Resolves false if the WebGPU device can't be acquired.
+ */
+export const warmup = (module: MainModule): Promise<boolean> => new Promise((resolve) => {
+  const idle = globalThis.requestIdleCallback ?? ((callback: () => void) => setTimeout(callback, 0));
+  const attempt = () => {
+    switch (module.warmup()) {
+      case 0:
+        resolve(true);
+        return;
+      case 2:
+        // the device request is in flight
+        setTimeout(() => idle(attempt), 100);
+        return;
+      default:
+        resolve(false);
+    }
+  };
+  idle(attempt);
+});
+
+/**
+ * Load the data by writing it straight into the wasm memory, which spares marshalling it as a string.
+ */
+export const loadBytes = (module: MainModule, TVG: TvgLottieAnimation, data: Uint8Array, fileType: string, width: number, height: number): boolean => {
+  const ptr = TVG.allocate(data.byteLength);
+  if (!ptr) {
+    return false;
+  }
+
+  // NOTE: allocate() may grow the memory, access HEAPU8 after it
+  module.HEAPU8.set(data, ptr);
+  return TVG.loadBuffer(fileType, width, height);
+}
+
+/**
+ * Wrap the rendered pixels of the sw engine in place, without copying them out of the wasm memory.
+ * The given image is returned as is while it still maps the buffer, a new one is made after the memory grows or the size changes.
+ * Returns undefined when the memory can't be mapped (ImageData doesn't accept the shared memory of the multi-threaded module).
+ */
+export const mapPixels = (module: MainModule, TVG: TvgLottieAnimation, width: number, height: number, image?: ImageData): ImageData | undefined => {
+  const heap = module.HEAPU8.buffer;
+  if (typeof SharedArrayBuffer !== 'undefined' && heap instanceof SharedArrayBuffer) {
+    return;
+  }
+
+  const ptr = TVG.buffer();
+  const bytes = TVG.bytes();
+  if (!ptr || bytes !== width * height * 4) {
+    return;
+  }
+
+  if (image && image.data.buffer === heap && image.data.byteOffset === ptr && image.width === width && image.height === height) {
+    return image;
+  }
+
+  return new ImageData(new Uint8ClampedArray(heap, ptr, bytes), width, height);
+}
+
+// holds shorter than this are played through with the display refresh
+const IDLE_THRESHOLD = 100;
+
+/**
+ * Time (ms) to sleep through the hold the animation is in, in which the frames don't change visually.
+ * 0 if the rest of the hold is too short to bother.
+ */
+export const idleTime = (TVG: TvgLottieAnimation, currentFrame: number, totalFrame: number, direction: number, speed: number): number => {
+  const [begin, end] = TVG.hold();
+  const frames = direction === 1 ? end - currentFrame : currentFrame - begin;
+  if (frames <= 0 || totalFrame <= 0 || speed <= 0) {
+    return 0;
+  }
+
+  // wake up a display frame earlier to be in time for the change
+  const time = frames / totalFrame * TVG.duration() / speed * 1000 - 1000 / 60;
+  return time > IDLE_THRESHOLD ? time : 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023 - 2025 the ThorVG project. All rights reserved.
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Messages between the player element (main thread) and its rendering worker
+
+// Define commands sent to the worker
+export enum WorkerCommand {
+  Init = 'init',
+  Load = 'load',
+  Cancel = 'cancel',
+  Play = 'play',
+  Pause = 'pause',
+  Stop = 'stop',
+  Seek = 'seek',
+  Resize = 'resize',
+  Config = 'config',
+  Quality = 'quality',
+  Segment = 'segment',
+  Destroy = 'destroy',
+}
+
+// Define events posted back by the worker
+export enum WorkerEvent {
+  Ready = 'ready',
+  Load = 'load',
+  Segment = 'segment',
+  Frame = 'frame',
+  Loop = 'loop',
+  Complete = 'complete',
+  Error = 'error',
+}
+
+// Playback options mirrored from the player properties
+export type PlaybackConfig = {
+  speed: number;
+  loop: boolean;
+  count?: number;
+  direction: number;
+  mode: string;
+  intermission: number;
+}
+
+export type WorkerRequest =
+  | { type: WorkerCommand.Init, canvas: OffscreenCanvas, renderer: string, wasmUrl: string, frameCache?: { budget: number, compress?: boolean }, adaptive?: { frameTime: number }, frameRate?: number, idle?: boolean }
+  | { type: WorkerCommand.Load, id: number, data: Uint8Array, fileType: string, width: number, height: number }
+  | { type: WorkerCommand.Cancel, id: number }
+  | { type: WorkerCommand.Play }
+  | { type: WorkerCommand.Pause }
+  | { type: WorkerCommand.Stop }
+  | { type: WorkerCommand.Seek, frame: number }
+  | { type: WorkerCommand.Resize, width: number, height: number }
+  | { type: WorkerCommand.Config, config: PlaybackConfig }
+  | { type: WorkerCommand.Quality, value: number }
+  | { type: WorkerCommand.Segment, marker?: string, begin?: number, end?: number }
+  | { type: WorkerCommand.Destroy };
+
+export type WorkerResponse =
+  | { type: WorkerEvent.Ready }
+  | { type: WorkerEvent.Load, id: number, totalFrame: number, duration: number, size: [number, number], markers: { name: string, begin: number, end: number }[] }
+  | { type: WorkerEvent.Segment, totalFrame: number, duration: number }
+  | { type: WorkerEvent.Frame, frame: number }
+  | { type: WorkerEvent.Loop }
+  | { type: WorkerEvent.Complete }
+  | { type: WorkerEvent.Error, message: string };
@@ -8,26 +8,53 @@ if [ -z "$2" ]; then
   EMSDK="$1"
 fi
 
+# the player maps the rendered pixels in HEAPU8 directly
+RUNTIME="s|-sEXPORTED_RUNTIME_METHODS=FS|-sEXPORTED_RUNTIME_METHODS=FS,HEAPU8|g"
+
+# The lite builds specialize the binding for their single engine, without the frame export.
+# Their lottie features are picked by
+#   LOTTIE_EXPRESSIONS=true: the expressions of the lottie loader (default: off)
+#   LOTTIE_TEXT=false: no text layers, without the ttf loader and the default font (default: on)
+LITE_EXTRA=""
+LITE_LOADERS=""
+LITE_FONT="-DTHORVG_WASM_NO_DEFAULT_FONT"
+if [ "${LOTTIE_EXPRESSIONS:-false}" == "true" ]; then
+  LITE_EXTRA="lottie_exp"
+fi
+if [ "${LOTTIE_TEXT:-true}" == "true" ]; then
+  LITE_LOADERS=", ttf"
+  LITE_FONT=""
+fi
+
+_lite() {
+  echo "s|cpp_args = \\[|cpp_args = ['-DTHORVG_WASM_ENGINE_$1', '-DTHORVG_WASM_NO_EXPORT', ${LITE_FONT:+'$LITE_FONT', }|g"
+}
+
 cd ../../thorvg
 rm -rf build_wasm
 
 if [[ "$BACKEND" == "wg" ]]; then
-  sed "s|EMSDK:|$EMSDK|g" ./cross/wasm32_wg.txt > /tmp/.wasm_cross.txt
+  sed "$RUNTIME; s|EMSDK:|$EMSDK|g" ./cross/wasm32_wg.txt > /tmp/.wasm_cross.txt
   meson setup -Db_lto=true -Ddefault_library=static -Dstatic=true -Dloaders="lottie, jpg, png, webp, ttf" -Dthreads=false -Dfile="false" -Dbindings="wasm_beta" -Dpartial=false -Dengines="wg" --cross-file /tmp/.wasm_cross.txt build_wasm
 elif [[ "$BACKEND" == "sw" ]]; then
-  sed "s|EMSDK:|$EMSDK|g" ./cross/wasm32_sw.txt > /tmp/.wasm_cross.txt
+  sed "$RUNTIME; s|EMSDK:|$EMSDK|g" ./cross/wasm32_sw.txt > /tmp/.wasm_cross.txt
   meson setup -Db_lto=true -Ddefault_library=static -Dstatic=true -Dloaders="lottie, jpg, png, webp, ttf" -Dthreads=false -Dbindings="wasm_beta" -Dpartial=false -Dfile="false" --cross-file /tmp/.wasm_cross.txt build_wasm
+elif [[ "$BACKEND" == "sw-mt" ]]; then
+  # THREADS: the number of the rasterizer workers preallocated in the pthread pool (default: 4)
+  THREADS="${THREADS:-4}"
+  sed "$RUNTIME; s|EMSDK:|$EMSDK|g; s|cpp_args = \[|cpp_args = ['-pthread', '-DTHORVG_WASM_THREADS=$THREADS', |g; s|'--bind'|'--bind', '-pthread', '-sPTHREAD_POOL_SIZE=$THREADS'|g" ./cross/wasm32_sw.txt > /tmp/.wasm_cross.txt
+  meson setup -Db_lto=true -Ddefault_library=static -Dstatic=true -Dloaders="lottie, jpg, png, webp, ttf" -Dthreads=true -Dbindings="wasm_beta" -Dpartial=false -Dfile="false" --cross-file /tmp/.wasm_cross.txt build_wasm
 elif [[ "$BACKEND" == "gl" ]]; then
-  sed "s|EMSDK:|$EMSDK|g" ./cross/wasm32_gl.txt > /tmp/.wasm_cross.txt
+  sed "$RUNTIME; s|EMSDK:|$EMSDK|g" ./cross/wasm32_gl.txt > /tmp/.wasm_cross.txt
   meson setup -Db_lto=true -Ddefault_library=static -Dstatic=true -Dloaders="lottie, jpg, png, webp, ttf" -Dthreads=false -Dbindings="wasm_beta" -Dpartial=false -Dengines="gl" -Dfile="false" --cross-file /tmp/.wasm_cross.txt build_wasm
 elif [[ "$BACKEND" == "sw-lite" ]]; then
-  sed "s|EMSDK:|$EMSDK|g" ./cross/wasm32_sw.txt > /tmp/.wasm_cross.txt
-  meson setup -Db_lto=true -Ddefault_library=static -Dstatic=true -Dloaders="lottie, png" -Dextra="" -Dthreads=false -Dbindings="wasm_beta" -Dpartial=false -Dfile="false" --cross-file /tmp/.wasm_cross.txt build_wasm
+  sed "$RUNTIME; $(_lite SW); s|EMSDK:|$EMSDK|g" ./cross/wasm32_sw.txt > /tmp/.wasm_cross.txt
+  meson setup -Db_lto=true -Ddefault_library=static -Dstatic=true -Dloaders="lottie, png$LITE_LOADERS" -Dextra="$LITE_EXTRA" -Dthreads=false -Dbindings="wasm_beta" -Dpartial=false -Dfile="false" --cross-file /tmp/.wasm_cross.txt build_wasm
 elif [[ "$BACKEND" == "gl-lite" ]]; then
-  sed "s|EMSDK:|$EMSDK|g" ./cross/wasm32_gl.txt > /tmp/.wasm_cross.txt
-  meson setup -Db_lto=true -Ddefault_library=static -Dstatic=true -Dloaders="lottie, png" -Dextra="" -Dthreads=false -Dbindings="wasm_beta" -Dpartial=false -Dengines="gl" -Dfile="false" --cross-file /tmp/.wasm_cross.txt build_wasm
+  sed "$RUNTIME; $(_lite GL); s|EMSDK:|$EMSDK|g" ./cross/wasm32_gl.txt > /tmp/.wasm_cross.txt
+  meson setup -Db_lto=true -Ddefault_library=static -Dstatic=true -Dloaders="lottie, png$LITE_LOADERS" -Dextra="$LITE_EXTRA" -Dthreads=false -Dbindings="wasm_beta" -Dpartial=false -Dengines="gl" -Dfile="false" --cross-file /tmp/.wasm_cross.txt build_wasm
 else
-  sed "s|EMSDK:|$EMSDK|g; s|'--bind'|'--bind', '--emit-tsd=thorvg.d.ts'|g" ./cross/wasm32.txt > /tmp/.wasm_cross.txt
+  sed "$RUNTIME; s|EMSDK:|$EMSDK|g; s|'--bind'|'--bind', '--emit-tsd=thorvg.d.ts'|g" ./cross/wasm32.txt > /tmp/.wasm_cross.txt
   meson setup -Db_lto=true -Ddefault_library=static -Dstatic=true -Dloaders="all" -Dsavers="all" -Dthreads=false -Dbindings="wasm_beta" -Dpartial=false -Dengines="all" --cross-file /tmp/.wasm_cross.txt build_wasm
 fi
 
@@ -9,6 +9,14 @@ rm -rf build_wasm && sh ./wasm_build.sh sw $EMSDK/
 mkdir -p ./dist/sw
 mv ../../thorvg/build_wasm/src/bindings/wasm/thorvg.{wasm,js} ./dist/sw
 
+rm -rf build_wasm && sh ./wasm_build.sh sw-mt $EMSDK/
+mkdir -p ./dist/sw-mt
+mv ../../thorvg/build_wasm/src/bindings/wasm/thorvg.{wasm,js} ./dist/sw-mt
+
+# single-threaded fallback for the pages not cross-origin isolated
+mkdir -p ./dist/sw-mt/fallback
+cp ./dist/sw/thorvg.{wasm,js} ./dist/sw-mt/fallback
+
 rm -rf build_wasm && sh ./wasm_build.sh gl $EMSDK/
 mkdir -p ./dist/gl
 mv ../../thorvg/build_wasm/src/bindings/wasm/thorvg.{wasm,js} ./dist/gl